@@ -8,6 +8,8 @@
 #include <dfm-base/dfm_base_global.h>
 
 #include <QString>
+#include <QHash>
+#include <QMutex>
 #include <QtSql>
 
 DFMBASE_BEGIN_NAMESPACE
@@ -15,12 +17,26 @@ DFMBASE_BEGIN_NAMESPACE
 class SqliteConnectionPoolPrivate
 {
 public:
+    // prepared statements of one connection, most recently used first
+    struct StatementCache
+    {
+        QStringList order;
+        QHash<QString, QSqlQuery> queries;
+    };
+
     SqliteConnectionPoolPrivate();
     QString makeConnectionName(const QString &databaseName);
     QSqlDatabase createConnection(const QString &databaseName, const QString &connectionName);
+    bool openDatabase(QSqlDatabase &db);
+    void dropStatements(const QString &connectionName);
 
 public:
+    static constexpr int kMaxCachedStatements { 32 };
+
     QString connectionName;
+    QMutex mutex;
+    QHash<QString, QStringList> pragmas;   // database name -> pragmas run on every open
+    QHash<QString, StatementCache> statements;   // connection name -> prepared statements
 };
 
 DFMBASE_END_NAMESPACE
@@ -8,6 +8,7 @@
 #include <QDebug>
 #include <QString>
 #include <QThread>
+#include <QMutexLocker>
 #include <QCoreApplication>
 #include <QCryptographicHash>
 
@@ -34,7 +35,7 @@ QSqlDatabase SqliteConnectionPoolPrivate::createConnection(const QString &databa
     QSqlDatabase db = QSqlDatabase::addDatabase(kDatabaseType, connectionName);
     db.setDatabaseName(databaseName);
 
-    if (db.open()) {
+    if (openDatabase(db)) {
         qCInfo(logDFMBase).noquote() << QString("Connection created: %1, sn: %2").arg(connectionName).arg(++sn);
         return db;
     } else {
@@ -43,6 +44,32 @@ QSqlDatabase SqliteConnectionPoolPrivate::createConnection(const QString &databa
     }
 }
 
+bool SqliteConnectionPoolPrivate::openDatabase(QSqlDatabase &db)
+{
+    if (!db.open())
+        return false;
+
+    // pragmas such as synchronous only last as long as the connection
+    QStringList dbPragmas;
+    {
+        QMutexLocker lk(&mutex);
+        dbPragmas = pragmas.value(db.databaseName());
+    }
+    for (const QString &pragma : dbPragmas) {
+        QSqlQuery query(db);
+        if (!query.exec("PRAGMA " + pragma + ";"))
+            qCWarning(logDFMBase).noquote() << "Set pragma" << pragma << "failed:" << query.lastError().text();
+    }
+
+    return true;
+}
+
+void SqliteConnectionPoolPrivate::dropStatements(const QString &connectionName)
+{
+    QMutexLocker lk(&mutex);
+    statements.remove(connectionName);
+}
+
 SqliteConnectionPool::SqliteConnectionPool(QObject *parent)
     : QObject(parent), d(new SqliteConnectionPoolPrivate)
 {
@@ -67,19 +94,23 @@ QSqlDatabase SqliteConnectionPool::openConnection(const QString &databaseName)
     QString fullConnectionName = baseConnectionName + "_" + d->makeConnectionName(databaseName);
 
     if (QSqlDatabase::contains(fullConnectionName)) {
-        QSqlDatabase existingDb = QSqlDatabase::database(fullConnectionName);
-        qCDebug(logDFMBase).noquote() << QString("Test connection on borrow, execute: %1, for connection %2")
-                                                 .arg(kTestSql)
-                                                 .arg(fullConnectionName);
-        QSqlQuery query(kTestSql, existingDb);
-        if (query.lastError().type() != QSqlError::NoError && !existingDb.open()) {
-            qCCritical(logDFMBase).noquote() << "Open datatabase error:" << existingDb.lastError().text();
-            return QSqlDatabase();
+        // the connection is validated when a query on it fails, see reportError,
+        // a borrow only reopens a connection that has been closed
+        QSqlDatabase existingDb = QSqlDatabase::database(fullConnectionName, false);
+        if (!existingDb.isOpen()) {
+            // statements prepared before the connection was closed are invalid
+            d->dropStatements(fullConnectionName);
+            if (!d->openDatabase(existingDb)) {
+                qCCritical(logDFMBase).noquote() << "Open datatabase error:" << existingDb.lastError().text();
+                return QSqlDatabase();
+            }
         }
         return existingDb;
     } else {
         if (qApp != nullptr) {
-            QObject::connect(QThread::currentThread(), &QThread::finished, qApp, [fullConnectionName] {
+            QObject::connect(QThread::currentThread(), &QThread::finished, qApp, [this, fullConnectionName] {
+                // cached statements hold the connection, release them first
+                d->dropStatements(fullConnectionName);
                 if (QSqlDatabase::contains(fullConnectionName)) {
                     QSqlDatabase::removeDatabase(fullConnectionName);
                     qCInfo(logDFMBase).noquote() << QString("Connection deleted: %1").arg(fullConnectionName);
@@ -90,3 +121,81 @@ QSqlDatabase SqliteConnectionPool::openConnection(const QString &databaseName)
         return d->createConnection(databaseName, fullConnectionName);
     }
 }
+
+/*!
+ * \brief SqliteConnectionPool::setConnectionPragmas Set the pragmas executed
+ * each time a connection to the database is opened, e.g. "synchronous=NORMAL"
+ * \param databaseName
+ * \param pragmas
+ */
+void SqliteConnectionPool::setConnectionPragmas(const QString &databaseName, const QStringList &pragmas)
+{
+    QMutexLocker lk(&d->mutex);
+    d->pragmas.insert(databaseName, pragmas);
+}
+
+/*!
+ * \brief SqliteConnectionPool::prepareQuery Get a prepared query for the sql
+ * from the statement cache of the connection, the most recently used statements
+ * are kept. The query shares the statement with the cache, bind and execute it
+ * before preparing the same sql again, and call finish() on it when done, or an
+ * unfinished select keeps a read transaction open on the connection.
+ * \param db A connection from openConnection
+ * \param sql
+ * \param query Receives the prepared query, or the failed one
+ * \return false if the sql can not be prepared
+ */
+bool SqliteConnectionPool::prepareQuery(const QSqlDatabase &db, const QString &sql, QSqlQuery *query)
+{
+    Q_ASSERT(query);
+    QMutexLocker lk(&d->mutex);
+    auto &cache = d->statements[db.connectionName()];
+    auto it = cache.queries.find(sql);
+    if (it != cache.queries.end()) {
+        if (cache.order.first() != sql) {
+            cache.order.removeOne(sql);
+            cache.order.prepend(sql);
+        }
+        // release the result of the last use, the statement stays prepared
+        it->finish();
+        *query = it.value();
+        return true;
+    }
+
+    *query = QSqlQuery(db);
+    if (!query->prepare(sql))
+        return false;
+
+    cache.order.prepend(sql);
+    cache.queries.insert(sql, *query);
+    if (cache.order.size() > SqliteConnectionPoolPrivate::kMaxCachedStatements)
+        cache.queries.remove(cache.order.takeLast());
+
+    return true;
+}
+
+/*!
+ * \brief SqliteConnectionPool::reportError Validate the connection after a
+ * query on it failed, a broken connection is closed and reopened by the next borrow
+ * \param db
+ * \param error
+ */
+void SqliteConnectionPool::reportError(const QSqlDatabase &db, const QSqlError &error)
+{
+    if (error.type() == QSqlError::NoError || !db.isOpen())
+        return;
+
+    {
+        qCDebug(logDFMBase).noquote() << QString("Test connection on error, execute: %1, for connection %2")
+                                                 .arg(kTestSql)
+                                                 .arg(db.connectionName());
+        QSqlQuery query(kTestSql, db);
+        if (query.lastError().type() == QSqlError::NoError)
+            return;
+    }
+
+    qCWarning(logDFMBase).noquote() << "Connection broken:" << db.connectionName() << error.text();
+    d->dropStatements(db.connectionName());
+    QSqlDatabase brokenDb { db };
+    brokenDb.close();
+}
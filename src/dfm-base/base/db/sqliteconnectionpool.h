@@ -21,6 +21,9 @@ class SqliteConnectionPool : public QObject
 public:
     static SqliteConnectionPool &instance();
     QSqlDatabase openConnection(const QString &databaseName);
+    void setConnectionPragmas(const QString &databaseName, const QStringList &pragmas);
+    bool prepareQuery(const QSqlDatabase &db, const QString &sql, QSqlQuery *query);
+    void reportError(const QSqlDatabase &db, const QSqlError &error);
 
 private:
     explicit SqliteConnectionPool(QObject *parent = nullptr);
@@ -463,6 +463,9 @@ public:
         if (fn)
             fn(&query);
 
+        if (!ret)
+            SqliteConnectionPool::instance().reportError(db, query.lastError());
+
         return ret;
     }
 };
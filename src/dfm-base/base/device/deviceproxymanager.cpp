@@ -6,6 +6,7 @@
 #include "devicemanager.h"
 #include "deviceutils.h"
 #include "private/deviceproxymanager_p.h"
+#include "private/devicehelper.h"
 #include <dfm-base/utils/finallyutil.h>
 
 #include <QDBusServiceWatcher>
@@ -29,6 +30,19 @@ const OrgDeepinFilemanagerServerDeviceManagerInterface *DeviceProxyManager::getD
 QStringList DeviceProxyManager::getAllBlockIds(GlobalServerDefines::DeviceQueryOptions opts)
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        QStringList ids;
+        if (d->mirrorIds(true, &ids)) {
+            if (opts.testFlag(GlobalServerDefines::DeviceQueryOption::kNoCondition))
+                return ids;
+
+            QStringList filtered;
+            for (const auto &id : ids) {
+                if (DeviceHelper::isMatchedQueryOptions(queryBlockInfo(id), opts))
+                    filtered << id;
+            }
+            return filtered;
+        }
+
         auto &&reply = d->devMngDBus->GetBlockDevicesIdList(opts);
         reply.waitForFinished();
         return reply.value();
@@ -66,6 +80,10 @@ QStringList DeviceProxyManager::asyncGetAllBlockIdsByUUID(const QStringList &uui
 QStringList DeviceProxyManager::getAllProtocolIds()
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        QStringList ids;
+        if (d->mirrorIds(false, &ids))
+            return ids;
+
         auto &&reply = d->devMngDBus->GetProtocolDevicesIdList();
         reply.waitForFinished();
         return reply.value();
@@ -77,9 +95,15 @@ QStringList DeviceProxyManager::getAllProtocolIds()
 QVariantMap DeviceProxyManager::queryBlockInfo(const QString &id, bool reload)
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        QVariantMap info;
+        if (!reload && d->mirrorInfo(id, &info))
+            return info;
+
         auto &&reply = d->devMngDBus->QueryBlockDeviceInfo(id, reload);
         reply.waitForFinished();
-        return reply.value();
+        info = reply.value();
+        d->updateMirror(id, info);
+        return info;
     } else {
         return DevMngIns->getBlockDevInfo(id, reload);
     }
@@ -88,9 +112,15 @@ QVariantMap DeviceProxyManager::queryBlockInfo(const QString &id, bool reload)
 QVariantMap DeviceProxyManager::queryProtocolInfo(const QString &id, bool reload)
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        QVariantMap info;
+        if (!reload && d->mirrorInfo(id, &info))
+            return info;
+
         auto &&reply = d->devMngDBus->QueryProtocolDeviceInfo(id, reload);
         reply.waitForFinished();
-        return reply.value();
+        info = reply.value();
+        d->updateMirror(id, info);
+        return info;
     } else {
         return DevMngIns->getProtocolDevInfo(id, reload);
     }
@@ -99,6 +129,11 @@ QVariantMap DeviceProxyManager::queryProtocolInfo(const QString &id, bool reload
 QVariantMap DeviceProxyManager::asyncQueryBlockInfo(const QString &id, bool reload)
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        // only a ready mirror, fetching the snapshot could block as well.
+        QVariantMap info;
+        if (!reload && d->mirrorInfo(id, &info, false))
+            return info;
+
         auto fun = [=](const QString &id, bool reload) -> QDBusPendingReply<QVariantMap> {
             DeviceManagerInterface devMngDBus(kDeviceService, kDevMngPath, QDBusConnection::sessionBus());
             return devMngDBus.QueryBlockDeviceInfo(id, reload);
@@ -112,6 +147,11 @@ QVariantMap DeviceProxyManager::asyncQueryBlockInfo(const QString &id, bool relo
 QVariantMap DeviceProxyManager::asyncQueryProtocolInfo(const QString &id, bool reload)
 {
     if (d->isDBusRuning() && d->devMngDBus) {
+        // only a ready mirror, fetching the snapshot could block as well.
+        QVariantMap info;
+        if (!reload && d->mirrorInfo(id, &info, false))
+            return info;
+
         auto fun = [=](const QString &id, bool reload) -> QDBusPendingReply<QVariantMap> {
             DeviceManagerInterface devMngDBus(kDeviceService, kDevMngPath, QDBusConnection::sessionBus());
             return devMngDBus.QueryProtocolDeviceInfo(id, reload);
@@ -249,6 +289,7 @@ void DeviceProxyManagerPrivate::initConnection()
     });
     q->connect(dbusWatcher.data(), &QDBusServiceWatcher::serviceUnregistered, q, [this] {
         devMngDBus.reset();
+        resetMirror();
         connectToAPI();
         emit q->devMngDBusUnregistered();
         qCWarning(logDFMBase) << "server dbus unregistered, connected to API...";
@@ -303,6 +344,12 @@ void DeviceProxyManagerPrivate::connectToDBus()
 
     devMngDBus.reset(new DeviceManagerInterface(kDeviceService, kDevMngPath, QDBusConnection::sessionBus(), this));
     auto ptr = devMngDBus.data();
+    resetMirror();
+    // keep the mirror updated before the signals are forwarded.
+    connections << q->connect(ptr, &DeviceManagerInterface::DeviceSnapshotChanged, this, &DeviceProxyManagerPrivate::onSnapshotChanged);
+    connections << q->connect(ptr, &DeviceManagerInterface::SizeUsedChanged, this, &DeviceProxyManagerPrivate::onSizeChanged);
+    connections << q->connect(DevMngIns, &DeviceManager::blockDevMountedManually, this, &DeviceProxyManagerPrivate::onMountedManually);
+
     connections << q->connect(ptr, &DeviceManagerInterface::BlockDriveAdded, q, &DeviceProxyManager::blockDriveAdded);
     connections << q->connect(ptr, &DeviceManagerInterface::BlockDriveRemoved, q, &DeviceProxyManager::blockDriveRemoved);
     connections << q->connect(ptr, &DeviceManagerInterface::BlockDeviceAdded, q, &DeviceProxyManager::blockDevAdded);
@@ -344,6 +391,7 @@ void DeviceProxyManagerPrivate::connectToAPI()
     disconnCurrentConnections();
 
     devMngDBus.reset();
+    resetMirror();
     auto ptr = DevMngIns;
     connections << q->connect(ptr, &DeviceManager::blockDriveAdded, q, &DeviceProxyManager::blockDriveAdded);
     connections << q->connect(ptr, &DeviceManager::blockDriveRemoved, q, &DeviceProxyManager::blockDriveRemoved);
@@ -413,6 +461,155 @@ QVariantMap DeviceProxyManagerPrivate::asyncQueryInfo(const QString &id, bool re
     return fw->result();
 }
 
+/*!
+ * \brief fetch the devices snapshot from server if the mirror is not ready
+ * \return false if the server cannot provide a snapshot, the queries go to server then.
+ */
+bool DeviceProxyManagerPrivate::ensureMirror()
+{
+    {
+        QReadLocker lk(&mirrorLock);
+        if (mirrorReady || mirrorUnsupported)
+            return mirrorReady;
+    }
+
+    if (!devMngDBus)
+        return false;
+
+    auto &&reply = devMngDBus->QueryDevicesSnapshot();
+    reply.waitForFinished();
+    if (reply.isError()) {
+        qCWarning(logDFMBase) << "cannot query devices snapshot:" << reply.error().message();
+        if (reply.error().type() == QDBusError::UnknownMethod) {
+            QWriteLocker lk(&mirrorLock);
+            mirrorUnsupported = true;
+        }
+        return false;
+    }
+
+    auto toMirror = [](const QVariant &devices) {
+        QMap<QString, QVariantMap> mirror;
+        const QVariantMap &infos = qdbus_cast<QVariantMap>(devices);
+        for (auto iter = infos.cbegin(); iter != infos.cend(); ++iter)
+            mirror.insert(iter.key(), qdbus_cast<QVariantMap>(iter.value()));
+        return mirror;
+    };
+
+    using namespace GlobalServerDefines;
+    const QVariantMap &snapshot = reply.value();
+    QWriteLocker lk(&mirrorLock);
+    blockMirror = toMirror(snapshot.value(DeviceSnapshot::kBlockDevices));
+    protocolMirror = toMirror(snapshot.value(DeviceSnapshot::kProtocolDevices));
+    mirrorVersion = snapshot.value(DeviceSnapshot::kVersion).toULongLong();
+    staleMirrorIds.clear();
+    // a change was published while the snapshot was on its way, take it again next time.
+    mirrorReady = latestVersion <= mirrorVersion;
+    return mirrorReady;
+}
+
+bool DeviceProxyManagerPrivate::mirrorIds(bool block, QStringList *ids)
+{
+    if (!ensureMirror())
+        return false;
+
+    QReadLocker lk(&mirrorLock);
+    if (!mirrorReady)
+        return false;
+    *ids = block ? blockMirror.keys() : protocolMirror.keys();
+    return true;
+}
+
+bool DeviceProxyManagerPrivate::mirrorInfo(const QString &id, QVariantMap *info, bool fetch)
+{
+    if (fetch && !ensureMirror())
+        return false;
+
+    QReadLocker lk(&mirrorLock);
+    if (!mirrorReady || staleMirrorIds.contains(id))
+        return false;
+
+    auto iter = blockMirror.constFind(id);
+    if (iter == blockMirror.cend()) {
+        iter = protocolMirror.constFind(id);
+        if (iter == protocolMirror.cend())
+            return false;
+    }
+
+    *info = iter.value();
+    return true;
+}
+
+void DeviceProxyManagerPrivate::updateMirror(const QString &id, const QVariantMap &info)
+{
+    QWriteLocker lk(&mirrorLock);
+    if (!mirrorReady || info.isEmpty())
+        return;
+
+    auto &mirror = id.startsWith(kBlockDeviceIdPrefix) ? blockMirror : protocolMirror;
+    if (mirror.contains(id)) {
+        mirror.insert(id, info);
+        staleMirrorIds.remove(id);
+    }
+}
+
+void DeviceProxyManagerPrivate::resetMirror()
+{
+    QWriteLocker lk(&mirrorLock);
+    blockMirror.clear();
+    protocolMirror.clear();
+    staleMirrorIds.clear();
+    mirrorVersion = 0;
+    latestVersion = 0;
+    mirrorReady = false;
+    mirrorUnsupported = false;
+}
+
+void DeviceProxyManagerPrivate::onSnapshotChanged(qulonglong version, const QString &id, const QVariantMap &info)
+{
+    QWriteLocker lk(&mirrorLock);
+    latestVersion = qMax(latestVersion, version);
+    if (!mirrorReady || version <= mirrorVersion)
+        return;
+
+    if (version != mirrorVersion + 1) {
+        qCWarning(logDFMBase) << "devices snapshot changes are missed, expect:" << mirrorVersion + 1 << "got:" << version;
+        mirrorReady = false;
+        return;
+    }
+
+    mirrorVersion = version;
+    auto &mirror = id.startsWith(kBlockDeviceIdPrefix) ? blockMirror : protocolMirror;
+    if (info.isEmpty())
+        mirror.remove(id);
+    else
+        mirror.insert(id, info);
+    staleMirrorIds.remove(id);
+}
+
+void DeviceProxyManagerPrivate::onSizeChanged(const QString &id, qint64 total, qint64 avai)
+{
+    using namespace GlobalServerDefines;
+
+    QWriteLocker lk(&mirrorLock);
+    auto &mirror = id.startsWith(kBlockDeviceIdPrefix) ? blockMirror : protocolMirror;
+    auto iter = mirror.find(id);
+    if (iter == mirror.end())
+        return;
+
+    qint64 used = total - avai;
+    iter.value()[DeviceProperty::kSizeTotal] = static_cast<quint64>(total);
+    iter.value()[DeviceProperty::kSizeUsed] = static_cast<quint64>(used < 0 ? 0 : used);
+    iter.value()[DeviceProperty::kSizeFree] = static_cast<quint64>(avai);
+}
+
+void DeviceProxyManagerPrivate::onMountedManually(const QString &id)
+{
+    // the server publishes the mount later, ask for it until then.
+    QWriteLocker lk(&mirrorLock);
+    if (blockMirror.contains(id))
+        staleMirrorIds.insert(id);
+}
+
 void DeviceProxyManagerPrivate::addMounts(const QString &id, const QString &mpt)
 {
     QString p = mpt.endsWith("/") ? mpt : mpt + "/";
@@ -6,6 +6,7 @@
 #define DEVICEHELPER_H
 
 #include <dfm-base/dfm_base_global.h>
+#include <dfm-base/dbusservice/global_server_defines.h>
 
 #include <dfm-mount/base/dmount_global.h>
 #include <dfm-mount/dprotocoldevice.h>
@@ -45,6 +46,8 @@ public:
     static bool isMountableBlockDev(const BlockDevAutoPtr &dev, QString &why);
     static bool isMountableBlockDev(const QVariantMap &infos, QString &why);
 
+    static bool isMatchedQueryOptions(const QVariantMap &infos, GlobalServerDefines::DeviceQueryOptions opts);
+
     static bool isEjectableBlockDev(const QString &id, QString &why);
     static bool isEjectableBlockDev(const BlockDevAutoPtr &dev, QString &why);
     static bool isEjectableBlockDev(const QVariantMap &infos, QString &why);
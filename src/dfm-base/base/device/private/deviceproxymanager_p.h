@@ -13,6 +13,7 @@
 #include <QList>
 #include <QtCore/qobjectdefs.h>
 #include <QReadWriteLock>
+#include <QSet>
 
 using DeviceManagerInterface = OrgDeepinFilemanagerServerDeviceManagerInterface;
 class QDBusServiceWatcher;
@@ -38,9 +39,19 @@ public:
 
     QVariantMap asyncQueryInfo(const QString &id, bool reload, std::function<QDBusPendingReply<QVariantMap>(const QString &, bool)> func);
 
+    // local mirror of the server's device snapshot
+    bool ensureMirror();
+    bool mirrorIds(bool block, QStringList *ids);
+    bool mirrorInfo(const QString &id, QVariantMap *info, bool fetch = true);
+    void updateMirror(const QString &id, const QVariantMap &info);
+    void resetMirror();
+
 private Q_SLOTS:
     void addMounts(const QString &id, const QString &mpt);
     void removeMounts(const QString &id);
+    void onSnapshotChanged(qulonglong version, const QString &id, const QVariantMap &info);
+    void onSizeChanged(const QString &id, qint64 total, qint64 avai);
+    void onMountedManually(const QString &id);
 
 private:
     DeviceProxyManager *q { nullptr };
@@ -52,6 +63,15 @@ private:
     QMap<QString, QString> externalMounts;
     QMap<QString, QString> allMounts;
 
+    QReadWriteLock mirrorLock;
+    QMap<QString, QVariantMap> blockMirror;
+    QMap<QString, QVariantMap> protocolMirror;
+    QSet<QString> staleMirrorIds;   // changed by this process, not yet published by the server
+    qulonglong mirrorVersion { 0 };
+    qulonglong latestVersion { 0 };
+    bool mirrorReady { false };
+    bool mirrorUnsupported { false };   // the server is too old to provide snapshots
+
     enum {
         kNoneConnection = -1,
         kAPIConnecting,
@@ -82,6 +82,16 @@ inline constexpr char kDriveModel[] { "DriveModel" };
 inline constexpr char kPreferredDevice[] { "PreferredDevice" };
 }   // namespace DeviceProperty
 
+/*!
+ * \brief Keys of the snapshot returned by DeviceManager.QueryDevicesSnapshot,
+ * the devices are maps of id to the device property information
+ */
+namespace DeviceSnapshot {
+inline constexpr char kVersion[] { "Version" };
+inline constexpr char kBlockDevices[] { "BlockDevices" };
+inline constexpr char kProtocolDevices[] { "ProtocolDevices" };
+}   // namespace DeviceSnapshot
+
 /*!
  * \brief Options for processing the device list interface,
  * returning a list of devices with different contents
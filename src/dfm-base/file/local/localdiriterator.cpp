@@ -9,6 +9,7 @@
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/utils/fileutils.h>
+#include <dfm-base/utils/hidefilehelper.h>
 #include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 
 #include <dfm-io/denumerator.h>
@@ -201,8 +202,12 @@ QUrl LocalDirIterator::url() const
 void LocalDirIterator::cacheBlockIOAttribute()
 {
     const QUrl &rootUrl = this->url();
-    const QUrl &url = DFMIO::DFMUtils::buildFilePath(rootUrl.toString().toStdString().c_str(), ".hidden", nullptr);
-    d->hideFileList = DFMIO::DFMUtils::hideListFromUrl(url);
+    if (rootUrl.isLocalFile()) {
+        d->hideFileList = HideFileHelper::hideListOf(rootUrl.toLocalFile());
+    } else {
+        const QUrl &url = DFMIO::DFMUtils::buildFilePath(rootUrl.toString().toStdString().c_str(), ".hidden", nullptr);
+        d->hideFileList = DFMIO::DFMUtils::hideListFromUrl(url);
+    }
     d->isLocalDevice = FileUtils::isLocalDevice(rootUrl);
     d->isCdRomDevice = FileUtils::isCdRomDevice(rootUrl);
 }
@@ -218,6 +223,8 @@ void LocalDirIterator::setArguments(const QVariantMap &args)
         d->dfmioDirIterator->setSortMixed(args.value("mixFileAndDir").toBool());
     if (args.value("sortOrder").isValid())
         d->dfmioDirIterator->setSortOrder(static_cast<Qt::SortOrder>(args.value("sortOrder").toInt()));
+    if (args.value("oneByOne").isValid())
+        d->enumerateOneByOne = args.value("oneByOne").toBool();
 }
 
 QList<SortInfoPointer> LocalDirIterator::sortFileInfoList()
@@ -227,8 +234,9 @@ QList<SortInfoPointer> LocalDirIterator::sortFileInfoList()
 
     auto sortlist = d->dfmioDirIterator->sortFileInfoList();
     QList<SortInfoPointer> wsortlist;
+    wsortlist.reserve(sortlist.size());
     for (const auto &sortInfo : sortlist) {
-        SortInfoPointer tmp(new SortFileInfo);
+        auto tmp = SortInfoPointer::create();
         tmp->setUrl(sortInfo->url);
         tmp->setSize(sortInfo->filesize);
         tmp->setFile(sortInfo->isFile);
@@ -263,7 +271,7 @@ bool LocalDirIterator::oneByOne()
 bool LocalDirIterator::initIterator()
 {
     if (d->dfmioDirIterator)
-        return d->dfmioDirIterator->initEnumerator(oneByOne());
+        return d->dfmioDirIterator->initEnumerator(d->enumerateOneByOne || oneByOne());
     return false;
 }
 
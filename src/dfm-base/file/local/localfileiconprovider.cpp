@@ -3,20 +3,14 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "localfileiconprovider.h"
+#include "private/localfileiconprovider_p.h"
 
 #include <dfm-io/dfileinfo.h>
 
-namespace dfmbase {
-class LocalFileIconProviderPrivate
-{
-public:
-    LocalFileIconProviderPrivate();
-
-    QIcon fileSystemIcon(const QString &path) const;
-    QIcon fromTheme(QString iconName) const;
-};
-}
+#include <DGuiApplicationHelper>
+#include <DPlatformTheme>
 
+DGUI_USE_NAMESPACE
 using namespace dfmbase;
 LocalFileIconProviderPrivate::LocalFileIconProviderPrivate()
 {
@@ -39,32 +33,75 @@ QIcon LocalFileIconProviderPrivate::fileSystemIcon(const QString &path) const
     return icon;
 }
 
+/*!
+ * \brief drop the resolved icons, every thread resolves its icons again.
+ */
+void LocalFileIconProviderPrivate::resetThemeIcons() const
+{
+    QMutexLocker lk(&themeMutex);
+    themeIcons.clear();
+    generation.fetch_add(1, std::memory_order_release);
+}
+
+// must be called with themeMutex locked
+void LocalFileIconProviderPrivate::checkThemeName() const
+{
+    const QString &name = QIcon::themeName();
+    if (name == themeName)
+        return;
+
+    themeName = name;
+    themeIcons.clear();
+    generation.fetch_add(1, std::memory_order_release);
+}
+
 QIcon LocalFileIconProviderPrivate::fromTheme(QString iconName) const
 {
-    QIcon icon;
-    {
-        static QMutex mut;
-        QMutexLocker lk(&mut);
-        icon = QIcon::fromTheme(iconName);
+    // the icons of this thread are looked up without any lock.
+    ThreadIcons &local = threadIcons.localData();
+    if (Q_LIKELY(local.generation == generation.load(std::memory_order_acquire))) {
+        auto it = local.icons.constFind(iconName);
+        if (it != local.icons.cend())
+            return it.value();
     }
 
+    // QIcon::fromTheme is not thread safe.
+    QMutexLocker lk(&themeMutex);
+    checkThemeName();
+    const quint64 current = generation.load(std::memory_order_relaxed);
+    if (local.generation != current) {
+        local.icons.clear();
+        local.generation = current;
+    }
 
-    if (Q_LIKELY(!icon.isNull()))
-        return icon;
-
-    if (iconName == "application-vnd.debian.binary-package") {
-        iconName = "application-x-deb";
-    } else if (iconName == "application-vnd.rar") {
-        iconName = "application-zip";
-    } else if (iconName == "application-vnd.ms-htmlhelp") {
-        iconName = "chmsee";
-    } else if (iconName == "Zoom.png") {
-        iconName = "application-x-zoom";
-    } else {
+    const QString requested = iconName;
+    QIcon icon = themeIcons.value(requested);
+    if (!icon.isNull()) {
+        local.icons.insert(requested, icon);
         return icon;
     }
 
     icon = QIcon::fromTheme(iconName);
+    if (icon.isNull()) {
+        if (iconName == "application-vnd.debian.binary-package") {
+            iconName = "application-x-deb";
+        } else if (iconName == "application-vnd.rar") {
+            iconName = "application-zip";
+        } else if (iconName == "application-vnd.ms-htmlhelp") {
+            iconName = "chmsee";
+        } else if (iconName == "Zoom.png") {
+            iconName = "application-x-zoom";
+        } else {
+            return icon;
+        }
+
+        icon = QIcon::fromTheme(iconName);
+        if (icon.isNull())
+            return icon;
+    }
+
+    themeIcons.insert(requested, icon);
+    local.icons.insert(requested, icon);
 
     return icon;
 }
@@ -74,10 +111,14 @@ Q_GLOBAL_STATIC(LocalFileIconProvider, globalFIP)
 LocalFileIconProvider::LocalFileIconProvider()
     : d(new LocalFileIconProviderPrivate())
 {
+    // the cached icons do not follow the icon theme by themselves.
+    d->themeConnection = QObject::connect(DGuiApplicationHelper::instance()->systemTheme(), &DPlatformTheme::iconThemeNameChanged,
+                                          [this]() { d->resetThemeIcons(); });
 }
 
 LocalFileIconProvider::~LocalFileIconProvider()
 {
+    QObject::disconnect(d->themeConnection);
 }
 
 LocalFileIconProvider *LocalFileIconProvider::globalProvider()
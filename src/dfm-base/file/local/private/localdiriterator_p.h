@@ -46,6 +46,7 @@ private:
     QSet<QString> hideFileList;
     bool isLocalDevice = false;
     bool isCdRomDevice = false;
+    bool enumerateOneByOne = false;   // 本地目录也逐个遍历，而不是由fts一次读完排序
 };
 }
 #endif   // ABSTRACTDIRITERATOR_P_H
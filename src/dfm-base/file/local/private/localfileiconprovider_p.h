@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOCALFILEICONPROVIDER_P_H
+#define LOCALFILEICONPROVIDER_P_H
+
+#include <dfm-base/file/local/localfileiconprovider.h>
+
+#include <QIcon>
+#include <QHash>
+#include <QMutex>
+#include <QThreadStorage>
+#include <QObject>
+
+#include <atomic>
+
+namespace dfmbase {
+class LocalFileIconProviderPrivate
+{
+public:
+    // the icons a thread has looked up, valid while its generation is current.
+    struct ThreadIcons
+    {
+        quint64 generation { 0 };
+        QHash<QString, QIcon> icons;
+    };
+
+    LocalFileIconProviderPrivate();
+
+    QIcon fileSystemIcon(const QString &path) const;
+    QIcon fromTheme(QString iconName) const;
+    void resetThemeIcons() const;
+
+    QMetaObject::Connection themeConnection;
+
+    mutable QMutex themeMutex;
+    // guarded by themeMutex
+    mutable QString themeName;
+    mutable QHash<QString, QIcon> themeIcons;
+    // bumped whenever themeIcons are dropped, the thread icons of an older one are stale.
+    mutable std::atomic<quint64> generation { 1 };
+    mutable QThreadStorage<ThreadIcons> threadIcons;
+
+private:
+    void checkThemeName() const;
+};
+}
+
+#endif   // LOCALFILEICONPROVIDER_P_H
@@ -7,26 +7,27 @@
 
 #include <dfm-base/interfaces/sortfileinfo.h>
 
-#include <QPointer>
-
 namespace dfmbase {
+// 每个目录项都有一个，所以不保存q指针，标志位按位存放
 class SortFileInfoPrivate
 {
 public:
-    explicit SortFileInfoPrivate(SortFileInfo *qq);
-    ~SortFileInfoPrivate();
+    SortFileInfoPrivate()
+        : file(false), dir(false), symLink(false), hide(false),
+          readable(false), writeable(false), executable(false)
+    {
+    }
 
 public:
-    SortFileInfo *const q;   // SortFileInfo实例对象
     QUrl url;
     qint64 filesize { 0 };
-    bool file { false };
-    bool dir { false };
-    bool symLink { false };
-    bool hide { false };
-    bool readable { false };
-    bool writeable { false };
-    bool executable { false };
+    bool file : 1;
+    bool dir : 1;
+    bool symLink : 1;
+    bool hide : 1;
+    bool readable : 1;
+    bool writeable : 1;
+    bool executable : 1;
 };
 
 }
@@ -6,7 +6,7 @@
 
 namespace dfmbase {
 SortFileInfo::SortFileInfo()
-    : d(new SortFileInfoPrivate(this))
+    : d(new SortFileInfoPrivate)
 {
 
 }
@@ -106,15 +106,4 @@ bool SortFileInfo::isExecutable() const
     return d->executable;
 }
 
-SortFileInfoPrivate::SortFileInfoPrivate(SortFileInfo *qq)
-    : q(qq)
-{
-
-}
-
-SortFileInfoPrivate::~SortFileInfoPrivate()
-{
-
-}
-
 }
@@ -7,20 +7,236 @@
 #include <dfm-base/utils/fileutils.h>
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/base/device/deviceutils.h>
+#include <dfm-base/base/standardpaths.h>
 
 #include <QUrl>
 #include <QFileInfo>
 #include <QRegularExpression>
+#include <QDir>
+#include <QMutex>
+#include <QDataStream>
+#include <QSaveFile>
+#include <QSet>
+#include <QTimer>
+#include <QCoreApplication>
+
+#include <sys/stat.h>
 
 using namespace dfmbase;
 
+namespace {
+// a file detected by content, the name is part of the key since the globs are matched too.
+struct MimeCacheKey
+{
+    quint64 dev = 0;
+    quint64 ino = 0;
+    qint64 modified = 0;
+    qint64 size = 0;
+    uint nameHash = 0;
+
+    bool operator==(const MimeCacheKey &other) const
+    {
+        return ino == other.ino && dev == other.dev && modified == other.modified
+                && size == other.size && nameHash == other.nameHash;
+    }
+};
+
+inline uint qHash(const MimeCacheKey &key, uint seed = 0)
+{
+    return ::qHash(key.ino, seed) ^ ::qHash(key.modified) ^ key.nameHash;
+}
+
+constexpr quint32 kMimeCacheMagic = 0x64666d6d;   // "dfmm"
+constexpr quint32 kMimeCacheVersion = 1;
+// the count of entries in a generation.
+constexpr int kMaxMimeCacheEntries = 100000;
+// new entries are saved after this delay, the process may be killed without quitting.
+constexpr int kMimeCacheSaveDelay = 2000;
+
+/*!
+ * \brief the mime types detected by content, shared in process and kept across restarts.
+ * the entries are kept in two generations, the older one is dropped when the current one is full,
+ * and an entry found in the older one is moved to the current one.
+ * the new entries are saved shortly after they are found, when the application quits and on exit.
+ */
+class MimeTypeCache
+{
+public:
+    MimeTypeCache()
+    {
+        load();
+
+        if (!qApp)
+            return;
+
+        // lookups run in any thread, the entries are saved in the main thread.
+        timedSave = true;
+        saveTimer.setSingleShot(true);
+        saveTimer.setInterval(kMimeCacheSaveDelay);
+        saveTimer.moveToThread(qApp->thread());
+        QObject::connect(&saveTimer, &QTimer::timeout, &saveTimer, [this]() {
+            flush();
+        });
+        QObject::connect(qApp, &QCoreApplication::aboutToQuit, &saveTimer, [this]() {
+            flush();
+        });
+    }
+
+    ~MimeTypeCache()
+    {
+        flush();
+    }
+
+    QString find(const MimeCacheKey &key)
+    {
+        QMutexLocker lk(&mutex);
+        auto it = current.constFind(key);
+        if (it != current.constEnd())
+            return it.value();
+
+        const QString &name = previous.take(key);
+        if (!name.isEmpty())
+            insertLocked(key, name);
+        return name;
+    }
+
+    void insert(const MimeCacheKey &key, const QString &name)
+    {
+        QMutexLocker lk(&mutex);
+        insertLocked(key, name);
+        if (dirty)
+            return;
+
+        dirty = true;
+        lk.unlock();
+        if (timedSave)
+            QMetaObject::invokeMethod(&saveTimer, "start", Qt::QueuedConnection);
+    }
+
+    void flush()
+    {
+        QMutexLocker lk(&mutex);
+        if (!dirty)
+            return;
+
+        // save a snapshot, the lookups go on while it is written.
+        const QHash<MimeCacheKey, QString> older = previous;
+        const QHash<MimeCacheKey, QString> newer = current;
+        dirty = false;
+        lk.unlock();
+
+        save(older, newer);
+    }
+
+private:
+    static QString cacheFile()
+    {
+        return QString("%1/%2").arg(StandardPaths::location(StandardPaths::kCachePath), "MimeTypes.cache");
+    }
+
+    void insertLocked(const MimeCacheKey &key, const QString &name)
+    {
+        if (current.size() >= kMaxMimeCacheEntries) {
+            previous = current;
+            current.clear();
+        }
+        current.insert(key, name);
+    }
+
+    void load()
+    {
+        QFile file(cacheFile());
+        if (!file.open(QIODevice::ReadOnly))
+            return;
+
+        uchar *data = file.map(0, file.size());
+        if (!data)
+            return;
+
+        const QByteArray &buffer = QByteArray::fromRawData(reinterpret_cast<const char *>(data), static_cast<int>(file.size()));
+        QDataStream in(buffer);
+        in.setVersion(QDataStream::Qt_5_11);
+
+        quint32 magic = 0;
+        quint32 version = 0;
+        in >> magic >> version;
+        if (magic == kMimeCacheMagic && version == kMimeCacheVersion) {
+            QStringList names;
+            quint32 count = 0;
+            in >> names >> count;
+            previous.reserve(static_cast<int>(qMin<quint32>(count, 2 * kMaxMimeCacheEntries)));
+            for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+                MimeCacheKey key;
+                quint16 nameIndex = 0;
+                in >> key.dev >> key.ino >> key.modified >> key.size >> key.nameHash >> nameIndex;
+                if (nameIndex < names.size())
+                    previous.insert(key, names.at(nameIndex));
+            }
+        }
+
+        file.unmap(data);
+        if (in.status() != QDataStream::Ok) {
+            qCWarning(logDFMBase) << "invalid mime type cache:" << file.fileName();
+            previous.clear();
+        }
+    }
+
+    static void save(const QHash<MimeCacheKey, QString> &older, const QHash<MimeCacheKey, QString> &newer)
+    {
+        const QString &path = cacheFile();
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qCWarning(logDFMBase) << "failed to write mime type cache:" << file.errorString();
+            return;
+        }
+
+        // the mime type names are stored once.
+        QStringList names;
+        QHash<QString, quint16> nameIndexes;
+        QByteArray records;
+        QDataStream out(&records, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_5_11);
+        quint32 count = 0;
+        for (const auto *entries : { &older, &newer }) {
+            for (auto it = entries->cbegin(); it != entries->cend(); ++it) {
+                auto index = nameIndexes.constFind(it.value());
+                if (index == nameIndexes.constEnd()) {
+                    index = nameIndexes.insert(it.value(), static_cast<quint16>(names.size()));
+                    names.append(it.value());
+                }
+
+                const MimeCacheKey &key = it.key();
+                out << key.dev << key.ino << key.modified << key.size << key.nameHash << index.value();
+                ++count;
+            }
+        }
+
+        QDataStream header(&file);
+        header.setVersion(QDataStream::Qt_5_11);
+        header << kMimeCacheMagic << kMimeCacheVersion << names << count;
+        file.write(records);
+        file.commit();
+    }
+
+    QMutex mutex;
+    QHash<MimeCacheKey, QString> current;
+    QHash<MimeCacheKey, QString> previous;
+    bool dirty = false;
+    bool timedSave = false;
+    QTimer saveTimer;
+};
+
+Q_GLOBAL_STATIC(MimeTypeCache, mimeTypeCache)
+}
+
 static QStringList wrongMimeTypeNames {
     Global::Mime::kTypeAppXOleStorage, Global::Mime::kTypeAppZip
 };
 static QStringList officeSuffixList {
     "docx", "xlsx", "pptx", "doc", "ppt", "xls", "wps"
 };
-static const QStringList blackList { "/sys/kernel/security/apparmor/revision", "/sys/kernel/security/apparmor/policy/revision", "/sys/power/wakeup_count", "/proc/kmsg" };
+static const QSet<QString> blackList { "/sys/kernel/security/apparmor/revision", "/sys/kernel/security/apparmor/policy/revision", "/sys/power/wakeup_count", "/proc/kmsg" };
 
 DMimeDatabase::DMimeDatabase()
 {
@@ -68,7 +284,7 @@ QMimeType DMimeDatabase::mimeTypeForFile(const FileInfoPointer &fileInfo, QMimeD
     if (isMatchExtension || DeviceUtils::isLowSpeedDevice(QUrl::fromLocalFile(path))) {
         result = QMimeDatabase::mimeTypeForFile(fileInfo->pathOf(PathInfoType::kFilePath), QMimeDatabase::MatchExtension);
     } else {
-        result = QMimeDatabase::mimeTypeForFile(fileInfo->pathOf(PathInfoType::kFilePath), mode);
+        result = mimeTypeForContent(fileInfo->pathOf(PathInfoType::kFilePath), mode);
     }
 
     // temporary dirty fix, once WPS get installed, the whole mimetype database thing get fscked up.
@@ -90,20 +306,14 @@ QMimeType DMimeDatabase::mimeTypeForFile(const FileInfoPointer &fileInfo, QMimeD
 
 QMimeType DMimeDatabase::mimeTypeForFile(const QString &fileName, QMimeDatabase::MatchMode mode, const QString &inod, const bool isGvfs) const
 {
-    if (!inod.isEmpty() && inodMimetypeCache.contains(inod)) {
-        return inodMimetypeCache.value(inod);
-    }
     return mimeTypeForFile(QFileInfo(fileName), mode, inod, isGvfs);
 }
 
 QMimeType DMimeDatabase::mimeTypeForFile(const QFileInfo &fileInfo, QMimeDatabase::MatchMode mode, const QString &inod, const bool isGvfs) const
 {
+    Q_UNUSED(inod)
     Q_UNUSED(isGvfs)
     // 如果是低速设备，则先从扩展名去获取mime信息；对于本地文件，保持默认的获取策略
-    bool canCache = !inod.isEmpty();
-    if (!inod.isEmpty() && inodMimetypeCache.contains(inod)) {
-        return inodMimetypeCache.value(inod);
-    }
     if (fileInfo.isDir()) {
         return QMimeDatabase::mimeTypeForFile(QFileInfo("/home"), mode);
     }
@@ -138,7 +348,7 @@ QMimeType DMimeDatabase::mimeTypeForFile(const QFileInfo &fileInfo, QMimeDatabas
     if (isMatchExtension || DeviceUtils::isLowSpeedDevice(QUrl::fromLocalFile(path))) {
         result = QMimeDatabase::mimeTypeForFile(fileInfo, QMimeDatabase::MatchExtension);
     } else {
-        result = QMimeDatabase::mimeTypeForFile(fileInfo, mode);
+        result = mimeTypeForContent(fileInfo.filePath(), mode);
     }
 
     // temporary dirty fix, once WPS get installed, the whole mimetype database thing get fscked up.
@@ -151,15 +361,42 @@ QMimeType DMimeDatabase::mimeTypeForFile(const QFileInfo &fileInfo, QMimeDatabas
     if (officeSuffixList.contains(fileInfo.suffix()) && wrongMimeTypeNames.contains(result.name())) {
         QList<QMimeType> results = QMimeDatabase::mimeTypesForFileName(fileInfo.fileName());
         if (!results.isEmpty()) {
-            if (canCache) {
-                const_cast<DMimeDatabase *>(this)->inodMimetypeCache.insert(inod, results.first());
-            }
             return results.first();
         }
     }
-    if (canCache) {
-        const_cast<DMimeDatabase *>(this)->inodMimetypeCache.insert(inod, result);
+    return result;
+}
+
+/*!
+ * \brief detect the mime type of a regular file by its name and content.
+ * the result is cached by the device, inode, modified time, size and name of the file,
+ * so the content of a file is not read again until it is changed.
+ */
+QMimeType DMimeDatabase::mimeTypeForContent(const QString &filePath, QMimeDatabase::MatchMode mode) const
+{
+    struct stat st;
+    if (mode != QMimeDatabase::MatchDefault
+        || ::stat(QFile::encodeName(filePath).constData(), &st) != 0
+        || !S_ISREG(st.st_mode))
+        return QMimeDatabase::mimeTypeForFile(filePath, mode);
+
+    MimeCacheKey key;
+    key.dev = static_cast<quint64>(st.st_dev);
+    key.ino = static_cast<quint64>(st.st_ino);
+    key.modified = static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    key.size = static_cast<qint64>(st.st_size);
+    key.nameHash = ::qHash(filePath.mid(filePath.lastIndexOf('/') + 1));
+
+    const QString &name = mimeTypeCache->find(key);
+    if (!name.isEmpty()) {
+        const QMimeType &type = mimeTypeForName(name);
+        if (type.isValid())
+            return type;
     }
+
+    const QMimeType &result = QMimeDatabase::mimeTypeForFile(filePath, mode);
+    if (result.isValid())
+        mimeTypeCache->insert(key, result.name());
     return result;
 }
 
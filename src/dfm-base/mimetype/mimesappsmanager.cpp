@@ -22,6 +22,9 @@
 #include <QDebug>
 #include <QUrl>
 #include <QStandardPaths>
+#include <QDataStream>
+#include <QSaveFile>
+#include <QLocale>
 
 #undef signals
 extern "C" {
@@ -33,6 +36,186 @@ extern "C" {
 
 using namespace dfmbase;
 
+namespace {
+// bump it if the layout of the apps index is changed.
+constexpr quint32 kAppsIndexMagic = 0x64666d61;   // "dfma"
+constexpr quint32 kAppsIndexVersion = 2;
+
+struct AppsIndexEntry
+{
+    DesktopFile desktop;
+    qint64 modified = 0;
+    qint64 size = 0;
+    qint64 created = 0;
+};
+
+// the desktop files directly in a directory, and its sub directories.
+struct AppsIndexDir
+{
+    qint64 modified = -1;
+    QStringList subDirs;
+    QMap<QString, AppsIndexEntry> apps;
+};
+
+using AppsIndex = QMap<QString, AppsIndexDir>;
+
+QDataStream &operator<<(QDataStream &out, const AppsIndexEntry &entry)
+{
+    return out << entry.desktop << entry.modified << entry.size << entry.created;
+}
+
+QDataStream &operator>>(QDataStream &in, AppsIndexEntry &entry)
+{
+    return in >> entry.desktop >> entry.modified >> entry.size >> entry.created;
+}
+
+QDataStream &operator<<(QDataStream &out, const AppsIndexDir &dir)
+{
+    return out << dir.modified << dir.subDirs << dir.apps;
+}
+
+QDataStream &operator>>(QDataStream &in, AppsIndexDir &dir)
+{
+    return in >> dir.modified >> dir.subDirs >> dir.apps;
+}
+
+// the localized names in desktop files depend on the system locale.
+AppsIndex readAppsIndex(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+
+    // the whole index is mapped and parsed in one pass.
+    uchar *data = file.map(0, file.size());
+    if (!data)
+        return {};
+
+    const QByteArray &buffer = QByteArray::fromRawData(reinterpret_cast<const char *>(data), static_cast<int>(file.size()));
+    QDataStream in(buffer);
+    in.setVersion(QDataStream::Qt_5_11);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString locale;
+    AppsIndex index;
+    in >> magic >> version;
+    if (magic == kAppsIndexMagic && version == kAppsIndexVersion) {
+        in >> locale;
+        if (locale == QLocale::system().name())
+            in >> index;
+    }
+
+    file.unmap(data);
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(logDFMBase) << "invalid mime apps index:" << path;
+        return {};
+    }
+
+    return index;
+}
+
+void writeAppsIndex(const QString &path, const AppsIndex &index)
+{
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logDFMBase) << "failed to write mime apps index:" << file.errorString();
+        return;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_11);
+    out << kAppsIndexMagic << kAppsIndexVersion << QLocale::system().name() << index;
+    file.commit();
+}
+
+AppsIndexEntry readAppsEntry(const QString &filePath, const QFileInfo &info)
+{
+    AppsIndexEntry entry;
+    entry.modified = info.lastModified().toMSecsSinceEpoch();
+    entry.size = info.size();
+    entry.created = info.created().toMSecsSinceEpoch();
+    entry.desktop = DesktopFile(filePath);
+    return entry;
+}
+
+/*!
+ * \brief index the desktop files in \a path and its sub directories.
+ * the directory whose modified time is not changed is not listed again, its desktop files are taken
+ * from \a cached, and only those whose modified time or size is changed are parsed again.
+ * \return true if anything is changed.
+ */
+bool scanAppsDir(const QString &path, const AppsIndex &cached, AppsIndex *index, QStringList *order)
+{
+    if (index->contains(path))
+        return false;
+
+    const QFileInfo dirInfo(path);
+    if (!dirInfo.isDir())
+        return cached.contains(path);
+
+    const qint64 modified = dirInfo.lastModified().toMSecsSinceEpoch();
+    const auto old = cached.find(path);
+    bool changed = false;
+    AppsIndexDir dir;
+    if (old != cached.end() && old->modified == modified) {
+        dir = old.value();
+        // a file edited in place does not change the modified time of its directory.
+        for (auto it = dir.apps.begin(); it != dir.apps.end();) {
+            const QFileInfo info(it.key());
+            if (!info.exists()) {
+                it = dir.apps.erase(it);
+                changed = true;
+                continue;
+            }
+
+            if (info.lastModified().toMSecsSinceEpoch() != it->modified || info.size() != it->size) {
+                it.value() = readAppsEntry(it.key(), info);
+                changed = true;
+            }
+            ++it;
+        }
+    } else {
+        changed = true;
+        dir.modified = modified;
+        QDirIterator it(path, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
+        while (it.hasNext()) {
+            it.next();
+            const QFileInfo &info = it.fileInfo();
+            const QString &filePath = it.filePath();
+            if (info.isDir()) {
+                // the same as QDirIterator::Subdirectories, do not follow the links.
+                if (!info.isSymLink())
+                    dir.subDirs.append(filePath);
+                continue;
+            }
+
+            if (!filePath.endsWith(".desktop"))
+                continue;
+
+            if (old != cached.end()) {
+                const auto oldEntry = old->apps.constFind(filePath);
+                if (oldEntry != old->apps.constEnd()
+                    && oldEntry->modified == info.lastModified().toMSecsSinceEpoch()
+                    && oldEntry->size == info.size()) {
+                    dir.apps.insert(filePath, oldEntry.value());
+                    continue;
+                }
+            }
+
+            dir.apps.insert(filePath, readAppsEntry(filePath, info));
+        }
+    }
+
+    index->insert(path, dir);
+    order->append(path);
+    for (const QString &sub : dir.subDirs)
+        changed = scanAppsDir(sub, cached, index, order) || changed;
+
+    return changed;
+}
+}
+
 QStringList MimesAppsManager::DesktopFiles = {};
 QMap<QString, QStringList> MimesAppsManager::MimeApps = {};
 QMap<QString, QStringList> MimesAppsManager::DDE_MimeTypes = {};
@@ -434,6 +617,11 @@ QString MimesAppsManager::getMimeAppsCacheFile()
     return QString("%1/%2").arg(StandardPaths::location(StandardPaths::kCachePath), "MimeApps.json");
 }
 
+QString MimesAppsManager::getMimeAppsIndexFile()
+{
+    return QString("%1/%2").arg(StandardPaths::location(StandardPaths::kCachePath), "MimeApps.index");
+}
+
 QString MimesAppsManager::getMimeInfoCacheFilePath()
 {
     return "/usr/share/applications/mimeinfo.cache";
@@ -476,18 +664,32 @@ void MimesAppsManager::initMimeTypeApps()
     DDE_MimeTypes.clear();
 
     QMap<QString, QSet<QString>> mimeAppsSet;
+    QHash<QString, qint64> createdTimes;
     loadDDEMimeTypes();
-    for (const QString &desktopFolder : getApplicationsFolders()) {
-        QDirIterator it(desktopFolder, QStringList("*.desktop"), QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
-        while (it.hasNext()) {
-            it.next();
-            const QString &filePath = it.filePath();
-            DesktopFile desktopFile(filePath);
+
+    // only the changed directories are scanned again.
+    const QString &indexFile = getMimeAppsIndexFile();
+    const AppsIndex &cached = readAppsIndex(indexFile);
+    AppsIndex index;
+    QStringList dirOrder;
+    bool changed = false;
+    for (const QString &desktopFolder : getApplicationsFolders())
+        changed = scanAppsDir(desktopFolder, cached, &index, &dirOrder) || changed;
+
+    if (changed || cached.size() != index.size())
+        writeAppsIndex(indexFile, index);
+
+    for (const QString &dirPath : dirOrder) {
+        const AppsIndexDir &dir = index.value(dirPath);
+        for (auto it = dir.apps.cbegin(); it != dir.apps.cend(); ++it) {
+            const QString &filePath = it.key();
+            const DesktopFile &desktopFile = it->desktop;
             if (desktopFile.isNoShow())
                 continue;
 
             DesktopFiles.append(filePath);
             DesktopObjs.insert(filePath, desktopFile);
+            createdTimes.insert(filePath, it->created);
             QStringList mimeTypes = desktopFile.desktopMimeType();
             QString fileName = QFileInfo(filePath).fileName();
             if (DDE_MimeTypes.contains(fileName)) {
@@ -495,39 +697,20 @@ void MimesAppsManager::initMimeTypeApps()
             }
 
             for (const QString &mimeType : mimeTypes) {
-                if (!mimeType.isEmpty()) {
-                    QSet<QString> apps;
-                    if (mimeAppsSet.contains(mimeType)) {
-                        apps = mimeAppsSet.value(mimeType);
-                        apps.insert(filePath);
-                    } else {
-                        apps.insert(filePath);
-                    }
-                    mimeAppsSet.insert(mimeType, apps);
-                }
+                if (!mimeType.isEmpty())
+                    mimeAppsSet[mimeType].insert(filePath);
             }
         }
     }
 
-    for (const QString &key : mimeAppsSet.keys()) {
-        QSet<QString> apps = mimeAppsSet.value(key);
-        QStringList orderApps;
-        if (apps.count() > 1) {
-            QFileInfoList fileInfos;
-            for (const QString &app : apps) {
-                QFileInfo info(app);
-                fileInfos.append(info);
-            }
-
-            std::sort(fileInfos.begin(), fileInfos.end(), MimesAppsManager::lessByDateTime);
-
-            for (const QFileInfo &info : fileInfos) {
-                orderApps.append(info.absoluteFilePath());
-            }
-        } else {
-            orderApps.append(apps.toList());
+    for (auto it = mimeAppsSet.cbegin(); it != mimeAppsSet.cend(); ++it) {
+        QStringList orderApps = it.value().toList();
+        if (orderApps.count() > 1) {
+            std::sort(orderApps.begin(), orderApps.end(), [&createdTimes](const QString &app1, const QString &app2) {
+                return createdTimes.value(app1) < createdTimes.value(app2);
+            });
         }
-        MimeApps.insert(key, orderApps);
+        MimeApps.insert(it.key(), orderApps);
     }
 
     //check mime apps from cache
@@ -574,7 +757,7 @@ void MimesAppsManager::initMimeTypeApps()
         const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
         if (!QFile::exists(path))
             continue;
-        DesktopFile df(path);
+        const DesktopFile &df = DesktopObjs.contains(path) ? DesktopObjs.value(path) : DesktopFile(path);
         AudioMimeApps.insert(path, df);
     }
 
@@ -582,7 +765,7 @@ void MimesAppsManager::initMimeTypeApps()
         const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
         if (!QFile::exists(path))
             continue;
-        DesktopFile df(path);
+        const DesktopFile &df = DesktopObjs.contains(path) ? DesktopObjs.value(path) : DesktopFile(path);
         ImageMimeApps.insert(path, df);
     }
 
@@ -590,7 +773,7 @@ void MimesAppsManager::initMimeTypeApps()
         const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
         if (!QFile::exists(path))
             continue;
-        DesktopFile df(path);
+        const DesktopFile &df = DesktopObjs.contains(path) ? DesktopObjs.value(path) : DesktopFile(path);
         TextMimeApps.insert(path, df);
     }
 
@@ -598,7 +781,7 @@ void MimesAppsManager::initMimeTypeApps()
         const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
         if (!QFile::exists(path))
             continue;
-        DesktopFile df(path);
+        const DesktopFile &df = DesktopObjs.contains(path) ? DesktopObjs.value(path) : DesktopFile(path);
         VideoMimeApps.insert(path, df);
     }
 
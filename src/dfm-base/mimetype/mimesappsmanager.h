@@ -81,6 +81,7 @@ public:
 
     static QStringList getApplicationsFolders();
     static QString getMimeAppsCacheFile();
+    static QString getMimeAppsIndexFile();
     static QString getMimeInfoCacheFilePath();
     static QString getMimeInfoCacheFileRootPath();
     static QString getDesktopFilesCacheFile();
@@ -0,0 +1,101 @@
+# Generates the pinyin table of dfm-base from pinyin.dict at build time:
+#   cmake -DDICT_FILE=pinyin.dict -DOUTPUT_FILE=pinyintable.h -P pinyintable.cmake
+#
+# Every line of the dict is "<code point in hex>:<syllable>". The output is a dense
+# table over the code points of the dict, each entry is the offset of its syllable in
+# a pool of NUL terminated syllables, offset 0 means no pinyin.
+
+cmake_minimum_required(VERSION 3.10)
+
+function(hex_to_dec hex out)
+    string(TOLOWER "${hex}" hex)
+    string(REGEX REPLACE "^0x" "" hex "${hex}")
+    string(LENGTH "${hex}" len)
+    math(EXPR last "${len} - 1")
+    set(dec 0)
+    foreach(i RANGE ${last})
+        string(SUBSTRING "${hex}" ${i} 1 digit)
+        string(FIND "0123456789abcdef" "${digit}" value)
+        math(EXPR dec "${dec} * 16 + ${value}")
+    endforeach()
+    set(${out} ${dec} PARENT_SCOPE)
+endfunction()
+
+file(STRINGS "${DICT_FILE}" lines REGEX "^0x[0-9a-fA-F]+:[a-z][a-z0-9]*$")
+
+set(pool "\\0")
+set(pool_size 1)
+set(first -1)
+set(last -1)
+foreach(line IN LISTS lines)
+    string(FIND "${line}" ":" sep)
+    string(SUBSTRING "${line}" 0 ${sep} hex)
+    math(EXPR sep "${sep} + 1")
+    string(SUBSTRING "${line}" ${sep} -1 syllable)
+    hex_to_dec(${hex} code)
+
+    if (NOT DEFINED offset_${syllable})
+        set(offset_${syllable} ${pool_size})
+        string(APPEND pool "${syllable}\\0")
+        string(LENGTH "${syllable}" len)
+        math(EXPR pool_size "${pool_size} + ${len} + 1")
+    endif()
+    set(code_${code} ${offset_${syllable}})
+
+    if (first LESS 0 OR code LESS first)
+        set(first ${code})
+    endif()
+    if (code GREATER last)
+        set(last ${code})
+    endif()
+endforeach()
+
+if (first LESS 0)
+    message(FATAL_ERROR "no pinyin found in ${DICT_FILE}")
+endif()
+if (pool_size GREATER 65535)
+    message(FATAL_ERROR "the syllables of ${DICT_FILE} do not fit in 16 bits offsets")
+endif()
+
+set(table "")
+set(column 0)
+foreach(code RANGE ${first} ${last})
+    if (DEFINED code_${code})
+        string(APPEND table "${code_${code}},")
+    else()
+        string(APPEND table "0,")
+    endif()
+    math(EXPR column "${column} + 1")
+    if (column EQUAL 32)
+        string(APPEND table "\n    ")
+        set(column 0)
+    endif()
+endforeach()
+
+math(EXPR end "${last} + 1")
+file(WRITE "${OUTPUT_FILE}.tmp"
+"// generated by pinyintable.cmake from pinyin.dict, do not edit.
+
+#ifndef PINYINTABLE_H
+#define PINYINTABLE_H
+
+namespace Pinyin {
+namespace Table {
+
+inline constexpr char16_t kBegin { ${first} };
+inline constexpr char16_t kEnd { ${end} };
+
+inline constexpr char kSyllables[] { \"${pool}\" };
+
+inline constexpr unsigned short kOffsets[kEnd - kBegin] {
+    ${table}
+};
+
+}   // namespace Table
+}   // namespace Pinyin
+
+#endif   // PINYINTABLE_H
+")
+# keep the timestamp when nothing changed, so that the users are not rebuilt.
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${OUTPUT_FILE}.tmp" "${OUTPUT_FILE}")
+file(REMOVE "${OUTPUT_FILE}.tmp")
@@ -4,60 +4,54 @@
 
 #include "chinese2pinyin.h"
 
-#include <QHash>
-#include <QTextStream>
-#include <QFile>
+// generated from qrc/chinese2pinyin/pinyin.dict at build time
+#include "pinyintable.h"
 
 namespace Pinyin {
 
-static QHash<uint, QString> dict = {};
+// the table is constant data, so it can be used from any thread.
+static inline const char *Syllable(QChar ch) {
+    const char16_t key = ch.unicode();
+    if (key < Table::kBegin || key >= Table::kEnd)
+        return nullptr;
 
-const char kDictFile[] = ":/misc/pinyin.dict";
+    const unsigned short offset = Table::kOffsets[key - Table::kBegin];
+    return offset ? Table::kSyllables + offset : nullptr;
+}
 
-void InitDict() {
-    if (!dict.isEmpty()) {
-        return;
+int PinyinLength(const QString& words) {
+    int length = 0;
+    for (const QChar ch : words) {
+        const char *syllable = Syllable(ch);
+        length += syllable ? static_cast<int>(qstrlen(syllable)) : 1;
     }
 
-    dict.reserve(25333);
-
-    QFile file(kDictFile);
+    return length;
+}
 
-    if (!file.open(QIODevice::ReadOnly))
+void Chinese2Pinyin(const QString& words, QString& out) {
+    if (words.isEmpty())
         return;
 
-    QByteArray content = file.readAll();
-
-    file.close();
-
-    QTextStream stream(&content, QIODevice::ReadOnly);
-
-    while (!stream.atEnd()) {
-        const QString line = stream.readLine();
-        const QStringList items = line.split(QChar(':'));
+    const int from = out.size();
+    out.resize(from + PinyinLength(words));
 
-        if (items.size() == 2) {
-            dict.insert(static_cast<uint>(items[0].toInt(nullptr, 16)), items[1]);
+    QChar *dest = out.data() + from;
+    for (const QChar ch : words) {
+        const char *syllable = Syllable(ch);
+        if (!syllable) {
+            *dest++ = ch;
+            continue;
         }
+
+        while (*syllable)
+            *dest++ = QLatin1Char(*syllable++);
     }
 }
 
 QString Chinese2Pinyin(const QString& words) {
-    InitDict();
-
     QString result;
-
-    for (int i = 0; i < words.length(); ++i) {
-        const uint key = words.at(i).unicode();
-        auto find_result = dict.find(key);
-
-        if (find_result != dict.end()) {
-            result.append(find_result.value());
-        } else {
-            result.append(words.at(i));
-        }
-    }
-
+    Chinese2Pinyin(words, result);
     return result;
 }
 
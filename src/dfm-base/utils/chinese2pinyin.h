@@ -9,6 +9,10 @@
 
 namespace Pinyin {
 QString Chinese2Pinyin(const QString& words);
+// appends the pinyin of words to out, which can be reused between calls
+void Chinese2Pinyin(const QString& words, QString& out);
+// length of the pinyin of words
+int PinyinLength(const QString& words);
 };
 
 #endif  // CHINESE_2_PINYIN_H
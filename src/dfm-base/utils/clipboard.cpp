@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "clipboard.h"
+#include "private/clipboard_p.h"
 
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/base/urlroute.h>
@@ -16,11 +17,16 @@
 #include <QClipboard>
 #include <QMimeData>
 #include <QMutex>
+#include <QSet>
+#include <QSharedPointer>
+#include <QThreadStorage>
 #include <QDebug>
 #include <QUrl>
 
 #include <DThumbnailProvider>
 
+#include <atomic>
+
 #include <sys/stat.h>
 #include <unistd.h>
 #include <X11/Xlib.h>
@@ -28,62 +34,239 @@
 using namespace dfmbase;
 
 namespace GlobalData {
-static QList<QUrl> clipboardFileUrls;
+// decoded once per clipboard change and replaced as a whole, so readers
+// never see the urls of one change with the action of another
+struct ClipboardUrls
+{
+    quint64 generation { 0 };
+    ClipBoard::ClipboardAction action { ClipBoard::kUnknownAction };
+    QList<QUrl> urls;
+    QSet<QUrl> cutUrls;
+};
+// guarded by clipboardFileUrlsMutex
+static QSharedPointer<const ClipboardUrls> clipboardUrls { new ClipboardUrls };
 static QMutex clipboardFileUrlsMutex;
+// each thread keeps the snapshot it saw last and takes the mutex only
+// when the generation shows that the clipboard has changed since
+static std::atomic<quint64> clipboardGeneration { 0 };
+static QThreadStorage<QSharedPointer<const ClipboardUrls>> threadUrls;
 static QAtomicInt remoteCurrentCount = 0;
-static ClipBoard::ClipboardAction clipboardAction = ClipBoard::kUnknownAction;
 
 static constexpr char kUserIdKey[] = "userId";
 static constexpr char kRemoteCopyKey[] = "uos/remote-copy";
 static constexpr char kGnomeCopyKey[] = "x-special/gnome-copied-files";
 static constexpr char kRemoteAssistanceCopyKey[] = "uos/remote-copied-files";
 
-void onClipboardDataChanged()
+QSharedPointer<const ClipboardUrls> currentUrls()
 {
+    QSharedPointer<const ClipboardUrls> &local = threadUrls.localData();
+    if (!local || local->generation != clipboardGeneration.load(std::memory_order_acquire)) {
+        QMutexLocker lk(&clipboardFileUrlsMutex);
+        local = clipboardUrls;
+    }
+    return local;
+}
 
+void publishUrls(ClipBoard::ClipboardAction action, const QList<QUrl> &urls)
+{
+    QSharedPointer<ClipboardUrls> next(new ClipboardUrls);
+    next->action = action;
+    next->urls.reserve(urls.size());
+    for (const auto &url : urls) {
+        if (url.isValid() && !url.scheme().isEmpty())
+            next->urls << url;
+    }
+    if (action == ClipBoard::kCutAction) {
+        next->cutUrls.reserve(next->urls.size());
+        for (const auto &url : next->urls)
+            next->cutUrls.insert(url);
+    }
+
+    // writers are serialised, the generation only grows
     QMutexLocker lk(&clipboardFileUrlsMutex);
-    clipboardFileUrls.clear();
+    next->generation = clipboardUrls->generation + 1;
+    clipboardUrls = next;
+    clipboardGeneration.store(next->generation, std::memory_order_release);
+}
 
+void onClipboardDataChanged()
+{
     const QMimeData *mimeData = qApp->clipboard()->mimeData();
     if (!mimeData || mimeData->formats().isEmpty()) {
         qCWarning(logDFMBase) << "get null mimeData from QClipBoard or remote formats is null!";
+        publishUrls(currentUrls()->action, {});
+        return;
+    }
+    // our own payload already holds the urls, do not serialise and parse them again
+    if (auto ownData = qobject_cast<const ClipBoardMimeData *>(mimeData)) {
+        publishUrls(ownData->clipboardAction(), ownData->clipboardUrls());
         return;
     }
     if (mimeData->hasFormat(kRemoteCopyKey)) {
         qCWarning(logDFMBase) << "clipboard use other !";
-        clipboardAction = ClipBoard::kRemoteAction;
         remoteCurrentCount++;
+        publishUrls(ClipBoard::kRemoteAction, {});
         return;
     }
     // 远程协助功能
     if (mimeData->hasFormat(kRemoteAssistanceCopyKey)) {
         qCInfo(logDFMBase) << "Remote copy: set remote copy action";
-        clipboardAction = ClipBoard::kRemoteCopiedAction;
+        publishUrls(ClipBoard::kRemoteCopiedAction, {});
         return;
     }
     // 没有文件拷贝
     if (!mimeData->hasFormat(kGnomeCopyKey)) {
         qCWarning(logDFMBase) << "no kGnomeCopyKey target in mimedata formats!";
-        clipboardAction = ClipBoard::kUnknownAction;
+        publishUrls(ClipBoard::kUnknownAction, {});
         return;
     }
-    const QString &data = mimeData->data(kGnomeCopyKey);
-    const static QRegExp regCut("cut\nfile://"), regCopy("copy\nfile://");
-    if (data.contains(regCut)) {
-        clipboardAction = ClipBoard::kCutAction;
-    } else if (data.contains(regCopy)) {
-        clipboardAction = ClipBoard::kCopyAction;
+    const QByteArray &data = mimeData->data(kGnomeCopyKey);
+    if (data.contains("cut\nfile://")) {
+        publishUrls(ClipBoard::kCutAction, mimeData->urls());
+    } else if (data.contains("copy\nfile://")) {
+        publishUrls(ClipBoard::kCopyAction, mimeData->urls());
     } else {
         qCWarning(logDFMBase) << "wrong kGnomeCopyKey data = " << data;
-        clipboardAction = ClipBoard::kUnknownAction;
+        publishUrls(ClipBoard::kUnknownAction, mimeData->urls());
     }
+}
+}   // namespace GlobalData
 
-    for (const auto &url : mimeData->urls()) {
-        if (url.isValid() && !url.scheme().isEmpty())
-            clipboardFileUrls << url;
+ClipBoardMimeData::ClipBoardMimeData(const QList<QUrl> &urls, ClipBoard::ClipboardAction action)
+    : fileUrls(urls), action(action)
+{
+    lazyFormats << QStringLiteral("text/uri-list")
+                << QStringLiteral("text/plain")
+                << QString(GlobalData::kGnomeCopyKey)
+                << QStringLiteral("x-dfm-copied/file-icons");
+}
+
+bool ClipBoardMimeData::hasFormat(const QString &mimeType) const
+{
+    return lazyFormats.contains(mimeType) || QMimeData::hasFormat(mimeType);
+}
+
+QStringList ClipBoardMimeData::formats() const
+{
+    return lazyFormats + QMimeData::formats();
+}
+
+QVariant ClipBoardMimeData::retrieveData(const QString &mimeType, QVariant::Type type) const
+{
+    if (!lazyFormats.contains(mimeType))
+        return QMimeData::retrieveData(mimeType, type);
+
+    // urls() asks for a list, hand it over without an encode and decode round trip
+    if (type == QVariant::List && mimeType == QLatin1String("text/uri-list")) {
+        QVariantList list;
+        list.reserve(fileUrls.size());
+        for (const QUrl &url : fileUrls)
+            list << url;
+        return list;
     }
+
+    return payload(mimeType);
+}
+
+QByteArray ClipBoardMimeData::payload(const QString &mimeType) const
+{
+    auto it = payloads.constFind(mimeType);
+    if (it != payloads.constEnd())
+        return it.value();
+
+    QByteArray data;
+    if (mimeType == QLatin1String("text/uri-list"))
+        data = uriList();
+    else if (mimeType == QLatin1String("text/plain"))
+        data = plainText();
+    else if (mimeType == QLatin1String(GlobalData::kGnomeCopyKey))
+        data = gnomeCopiedFiles();
+    else
+        data = fileIcons();
+
+    payloads.insert(mimeType, data);
+    return data;
+}
+
+QByteArray ClipBoardMimeData::gnomeCopiedFiles() const
+{
+    QByteArray ba = (action == ClipBoard::kCutAction) ? "cut" : "copy";
+    for (const QUrl &url : fileUrls) {
+        ba.append('\n');
+        ba.append(url.toString().toUtf8());
+    }
+    return ba;
+}
+
+QByteArray ClipBoardMimeData::uriList() const
+{
+    QByteArray ba;
+    for (const QUrl &url : fileUrls) {
+        ba.append(url.toEncoded());
+        ba.append("\r\n");
+    }
+    return ba;
+}
+
+QByteArray ClipBoardMimeData::plainText() const
+{
+    QString text;
+    for (const QUrl &url : fileUrls) {
+        const QString &path = url.toLocalFile();
+        if (!path.isEmpty())
+            text += path + '\n';
+    }
+    if (text.endsWith('\n'))
+        text.chop(1);
+    return text.toUtf8();
+}
+
+QByteArray ClipBoardMimeData::fileIcons() const
+{
+    QByteArray iconBa;
+    QDataStream stream(&iconBa, QIODevice::WriteOnly);
+
+    int maxIconsNum = 3;
+    QString error;
+    for (const QUrl &qurl : fileUrls) {
+        if (maxIconsNum-- <= 0)
+            break;
+
+        const FileInfoPointer &info = InfoFactory::create<FileInfo>(qurl, Global::CreateFileInfoType::kCreateFileInfoAuto, &error);
+
+        if (!info) {
+            qCWarning(logDFMBase) << QString("create file info error, case : %1").arg(error);
+            continue;
+        }
+        QStringList iconList;
+        if (info->isAttributes(OptInfoType::kIsSymLink)) {
+            iconList << "emblem-symbolic-link";
+        }
+        if (!info->isAttributes(OptInfoType::kIsWritable)) {
+            iconList << "emblem-readonly";
+        }
+        if (!info->isAttributes(OptInfoType::kIsReadable)) {
+            iconList << "emblem-unreadable";
+        }
+        // TODO lanxs::目前缩略图还没有处理，等待处理完成了在修改
+        // 多文件时只显示文件图标, 一个文件时显示缩略图(如果有的话)
+        QIcon icon = LocalFileIconProvider::globalProvider()->icon(info.data());
+        FileInfo::FileType fileType = MimeTypeDisplayManager::
+                                              instance()
+                                                      ->displayNameToEnum(info->nameOf(NameInfoType::kMimeTypeName));
+        if (fileUrls.size() == 1 && fileType == FileInfo::FileType::kImages) {
+            QIcon thumb(DTK_GUI_NAMESPACE::DThumbnailProvider::instance()->thumbnailFilePath(QFileInfo(info->pathOf(PathInfoType::kAbsoluteFilePath)),
+                                                                                             DTK_GUI_NAMESPACE::DThumbnailProvider::Large));
+            if (thumb.isNull()) {
+                //qCWarning(logDFMBase) << "thumbnail file faild " << fileInfo->absoluteFilePath();
+            } else {
+                icon = thumb;
+            }
+        }
+        stream << iconList << icon;
+    }
+    return iconBa;
 }
-}   // namespace GlobalData
 
 ClipBoard::ClipBoard(QObject *parent)
     : QObject(parent)
@@ -113,65 +296,17 @@ void ClipBoard::setUrlsToClipboard(const QList<QUrl> &list, ClipBoard::Clipboard
     if (action == ClipBoard::kCutAction && SystemPathUtil::instance()->checkContainsSystemPath(list))
         return;
 
-    if (!mimeData)
-        mimeData = new QMimeData;
-
-    QByteArray ba = (action == ClipBoard::kCutAction) ? "cut" : "copy";
-    QString text;
-    QByteArray iconBa;
-    QDataStream stream(&iconBa, QIODevice::WriteOnly);
-
-    int maxIconsNum = 3;
-    QString error;
-    for (const QUrl &qurl : list) {
-        ba.append("\n");
-        ba.append(qurl.toString());
-
-        const QString &path = qurl.toLocalFile();
-        if (!path.isEmpty()) {
-            text += path + '\n';
-        }
-
-        if (maxIconsNum-- > 0) {
-            const FileInfoPointer &info = InfoFactory::create<FileInfo>(qurl, Global::CreateFileInfoType::kCreateFileInfoAuto, &error);
-
-            if (!info) {
-                qCWarning(logDFMBase) << QString("create file info error, case : %1").arg(error);
-                continue;
-            }
-            QStringList iconList;
-            if (info->isAttributes(OptInfoType::kIsSymLink)) {
-                iconList << "emblem-symbolic-link";
-            }
-            if (!info->isAttributes(OptInfoType::kIsWritable)) {
-                iconList << "emblem-readonly";
-            }
-            if (!info->isAttributes(OptInfoType::kIsReadable)) {
-                iconList << "emblem-unreadable";
-            }
-            // TODO lanxs::目前缩略图还没有处理，等待处理完成了在修改
-            // 多文件时只显示文件图标, 一个文件时显示缩略图(如果有的话)
-            QIcon icon = LocalFileIconProvider::globalProvider()->icon(info.data());
-            FileInfo::FileType fileType = MimeTypeDisplayManager::
-                                                  instance()
-                                                          ->displayNameToEnum(info->nameOf(NameInfoType::kMimeTypeName));
-            if (list.size() == 1 && fileType == FileInfo::FileType::kImages) {
-                QIcon thumb(DTK_GUI_NAMESPACE::DThumbnailProvider::instance()->thumbnailFilePath(QFileInfo(info->pathOf(PathInfoType::kAbsoluteFilePath)),
-                                                                                                 DTK_GUI_NAMESPACE::DThumbnailProvider::Large));
-                if (thumb.isNull()) {
-                    //qCWarning(logDFMBase) << "thumbnail file faild " << fileInfo->absoluteFilePath();
-                } else {
-                    icon = thumb;
-                }
-            }
-            stream << iconList << icon;
-        }
+    // the formats are serialised when a client asks for them
+    ClipBoardMimeData *lazyData = new ClipBoardMimeData(list, action);
+    if (mimeData) {
+        // a caller supplied container has to be filled in up front
+        for (const QString &format : lazyData->formats())
+            mimeData->setData(format, lazyData->data(format));
+        delete lazyData;
+    } else {
+        mimeData = lazyData;
     }
 
-    mimeData->setText(text.endsWith('\n') ? text.left(text.length() - 1) : text);
-    mimeData->setData("x-special/gnome-copied-files", ba);
-    mimeData->setData("x-dfm-copied/file-icons", iconBa);
-    mimeData->setUrls(list);
     // fix bug 63441
     // 如果是剪切操作，则禁止跨用户的粘贴操作
     if (ClipBoard::kCutAction == action) {
@@ -253,8 +388,7 @@ QList<QUrl> ClipBoard::getRemoteUrls()
  */
 QList<QUrl> ClipBoard::clipboardFileUrlList() const
 {
-    QMutexLocker lk(&GlobalData::clipboardFileUrlsMutex);
-    return GlobalData::clipboardFileUrls;
+    return GlobalData::currentUrls()->urls;
 }
 /*!
  * \brief ClipBoard::clipboardAction Gets the current operation of the clipboard
@@ -262,13 +396,36 @@ QList<QUrl> ClipBoard::clipboardFileUrlList() const
  */
 ClipBoard::ClipboardAction ClipBoard::clipboardAction() const
 {
-    return GlobalData::clipboardAction;
+    return GlobalData::currentUrls()->action;
+}
+
+/*!
+ * \brief ClipBoard::isCut Whether the url is in the clipboard of a cut,
+ * safe to call from any thread, locks only the first time a thread sees a new clipboard
+ * \param url
+ * \return
+ */
+bool ClipBoard::isCut(const QUrl &url) const
+{
+    const auto &current = GlobalData::currentUrls();
+    return current->action == kCutAction && current->cutUrls.contains(url);
+}
+
+/*!
+ * \brief ClipBoard::clipboardGeneration Grows every time the urls in the
+ * clipboard change, callers may compare it to skip re-evaluating their cut state
+ * \return
+ */
+quint64 ClipBoard::clipboardGeneration() const
+{
+    return GlobalData::currentUrls()->generation;
 }
 
 void ClipBoard::removeUrls(const QList<QUrl> &urls)
 {
-    QList<QUrl> clipboardUrls = GlobalData::clipboardFileUrls;
-    ClipBoard::ClipboardAction action = GlobalData::clipboardAction;
+    const auto &current = GlobalData::currentUrls();
+    QList<QUrl> clipboardUrls = current->urls;
+    ClipBoard::ClipboardAction action = current->action;
 
     if (!clipboardUrls.isEmpty() && action != ClipBoard::kUnknownAction) {
         bool hasRemoved = false;
@@ -287,8 +444,9 @@ void ClipBoard::removeUrls(const QList<QUrl> &urls)
 
 void ClipBoard::replaceClipboardUrl(const QUrl &oldUrl, const QUrl &newUrl)
 {
-    QList<QUrl> clipboardUrls = GlobalData::clipboardFileUrls;
-    ClipBoard::ClipboardAction action = GlobalData::clipboardAction;
+    const auto &current = GlobalData::currentUrls();
+    QList<QUrl> clipboardUrls = current->urls;
+    ClipBoard::ClipboardAction action = current->action;
     if (clipboardUrls.isEmpty() || action == ClipBoard::kUnknownAction)
         return;
 
@@ -312,8 +470,8 @@ QList<QUrl> ClipBoard::getUrlsByX11()
         qCWarning(logDFMBase) << "the clipboard mimedata is invalid!";
         return QList<QUrl>();
     }
-    if (GlobalData::clipboardAction != kRemoteAction) {
-        qCWarning(logDFMBase) << "current action is not RemoteAction ,error action " << GlobalData::clipboardAction;
+    if (GlobalData::currentUrls()->action != kRemoteAction) {
+        qCWarning(logDFMBase) << "current action is not RemoteAction ,error action " << GlobalData::currentUrls()->action;
         return QList<QUrl>();
     }
     //使用x11创建一个窗口去阻塞获取URl
@@ -426,10 +584,8 @@ QList<QUrl> ClipBoard::getUrlsByX11()
         clipboardFileUrls << temp;
     }
 
-    if (GlobalData::clipboardAction == kRemoteAction && currentCount == GlobalData::remoteCurrentCount) {
-        QMutexLocker lk(&GlobalData::clipboardFileUrlsMutex);
-        GlobalData::clipboardFileUrls.clear();
-        GlobalData::clipboardFileUrls = clipboardFileUrls;
+    if (GlobalData::currentUrls()->action == kRemoteAction && currentCount == GlobalData::remoteCurrentCount) {
+        GlobalData::publishUrls(kRemoteAction, clipboardFileUrls);
         GlobalData::remoteCurrentCount = 0;
     }
 
@@ -38,6 +38,8 @@ public:
 
     QList<QUrl> clipboardFileUrlList() const;
     ClipboardAction clipboardAction() const;
+    bool isCut(const QUrl &url) const;
+    quint64 clipboardGeneration() const;
     void removeUrls(const QList<QUrl> &urls);
     void replaceClipboardUrl(const QUrl &oldUrl, const QUrl &newUrl);
 
@@ -3,61 +3,117 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "desktopfile.h"
-#include "properties.h"
 
 #include <QFile>
-#include <QSettings>
+#include <QDataStream>
+#include <QHash>
+#include <QMutex>
+#include <QLocale>
+#include <QVariant>
 #include <QDebug>
 
+#include <sys/stat.h>
+
 using namespace dfmbase;
 
+namespace {
+// parsed desktop files shared in process, an entry is valid while its file is not changed.
+struct CachedDesktopFile
+{
+    qint64 modified = 0;
+    qint64 size = 0;
+    DesktopFile desktop;
+};
+
+struct DesktopFileCache
+{
+    QMutex mutex;
+    QHash<QString, CachedDesktopFile> files;
+};
+
+// drop all entries if too many files were parsed, such as desktop files being renamed frequently.
+constexpr int kMaxCachedDesktopFiles = 4096;
+
+Q_GLOBAL_STATIC(DesktopFileCache, desktopFileCache)
+
+/*!
+ * \brief read the entries of \a group in one pass, the later one wins if a key is duplicated.
+ * ';' is not regarded as comment, so the lists keep their separators.
+ */
+QHash<QString, QString> readGroup(const QString &fileName, const QString &group)
+{
+    QHash<QString, QString> entries;
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return entries;
+
+    const QByteArray &content = file.readAll();
+    bool groupFound = false;
+    int pos = 0;
+    while (pos < content.size()) {
+        int end = content.indexOf('\n', pos);
+        if (end < 0)
+            end = content.size();
+
+        const QString &line = QString::fromUtf8(content.constData() + pos, end - pos).trimmed();
+        pos = end + 1;
+        if (line.isEmpty())
+            continue;
+
+        // symbols '[' and ']' can be found not only in group names, but only group can start with '['
+        if (line.startsWith('[')) {
+            groupFound = QString(line).remove('[').remove(']') == group;
+            continue;
+        }
+
+        const int firstEqual = line.indexOf('=');
+        if (groupFound && firstEqual >= 0)
+            entries.insert(line.left(firstEqual).trimmed(), line.mid(firstEqual + 1).trimmed());
+    }
+
+    return entries;
+}
+}
+
 DesktopFile::DesktopFile(const QString &fileName)
     : fileName(fileName)
 {
     // File validity
-    if (fileName.isEmpty() || !QFile::exists(fileName)) {
+    struct stat st;
+    if (fileName.isEmpty() || ::stat(QFile::encodeName(fileName).constData(), &st) != 0) {
         return;
     }
 
-    QSettings settings(fileName, QSettings::IniFormat);
-    settings.beginGroup("Desktop Entry");
-    // Loads .desktop file (read from 'Desktop Entry' group)
-    Properties desktop(fileName, "Desktop Entry");
-
-    if (desktop.contains("X-Deepin-AppID")) {
-        deepinId = desktop.value("X-Deepin-AppID", settings.value("X-Deepin-AppID")).toString();
+    const qint64 modified = static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    const qint64 size = static_cast<qint64>(st.st_size);
+    {
+        QMutexLocker lk(&desktopFileCache->mutex);
+        auto it = desktopFileCache->files.constFind(fileName);
+        if (it != desktopFileCache->files.constEnd() && it->modified == modified && it->size == size) {
+            *this = it->desktop;
+            return;
+        }
     }
 
-    if (desktop.contains("X-Deepin-Vendor")) {
-        deepinVendor = desktop.value("X-Deepin-Vendor", settings.value("X-Deepin-Vendor")).toString();
-    }
+    // Loads .desktop file (read from 'Desktop Entry' group)
+    const QHash<QString, QString> &desktop = readGroup(fileName, "Desktop Entry");
 
-    if (desktop.contains("NoDisplay")) {
-        noDisplay = desktop.value("NoDisplay", settings.value("NoDisplay").toBool()).toBool();
-    }
-    if (desktop.contains("Hidden")) {
-        hidden = desktop.value("Hidden", settings.value("Hidden").toBool()).toBool();
-    }
+    deepinId = desktop.value("X-Deepin-AppID");
+    deepinVendor = desktop.value("X-Deepin-Vendor");
+    customOpen = desktop.value("X-DDE-File-Manager-Custom-Open");
+    noDisplay = QVariant(desktop.value("NoDisplay")).toBool();
+    hidden = QVariant(desktop.value("Hidden")).toBool();
 
     //由于获取的系统语言简写与.desktop的语言简写存在不对应关系，经决定先采用获取的系统值匹配
     //若没匹配到则采用系统值"_"左侧的字符串进行匹配，均为匹配到，才走原未匹配流程
-    auto getValueFromSys = [&desktop, &settings](const QString &type, const QString &sysName) -> QString {
-        const QString key = QString("%0[%1]").arg(type).arg(sysName);
-        return desktop.value(key, settings.value(key)).toString();
-    };
-
-    auto getNameByType = [&desktop, &settings, &getValueFromSys](const QString &type) -> QString {
-        QString tempSysName = QLocale::system().name();
-        QString targetName = getValueFromSys(type, tempSysName);
+    const QString &sysName = QLocale::system().name();
+    const QString &sysLanguage = sysName.trimmed().split("_").first();
+    auto getNameByType = [&desktop, &sysName, &sysLanguage](const QString &type) -> QString {
+        QString targetName = desktop.value(QString("%0[%1]").arg(type).arg(sysName));
         if (targetName.isEmpty()) {
-            auto strSize = tempSysName.trimmed().split("_");
-            if (!strSize.isEmpty()) {
-                tempSysName = strSize.first();
-                targetName = getValueFromSys(type, tempSysName);
-            }
-
+            targetName = desktop.value(QString("%0[%1]").arg(type).arg(sysLanguage));
             if (targetName.isEmpty())
-                targetName = desktop.value(type, settings.value(type)).toString();
+                targetName = desktop.value(type);
         }
 
         return targetName;
@@ -65,12 +121,12 @@ DesktopFile::DesktopFile(const QString &fileName)
     localName = getNameByType("Name");
     genericName = getNameByType("GenericName");
 
-    exec = desktop.value("Exec", settings.value("Exec")).toString();
-    icon = desktop.value("Icon", settings.value("Icon")).toString();
-    type = desktop.value("Type", settings.value("Type", "Application")).toString();
-    categories = desktop.value("Categories", settings.value("Categories").toString()).toString().remove(" ").split(";");
+    exec = desktop.value("Exec");
+    icon = desktop.value("Icon");
+    type = desktop.value("Type", "Application");
+    categories = desktop.value("Categories").remove(" ").split(";");
 
-    QString mimeTypeTemp = desktop.value("MimeType", settings.value("MimeType").toString()).toString().remove(" ");
+    QString mimeTypeTemp = desktop.value("MimeType").remove(" ");
 
     if (!mimeTypeTemp.isEmpty())
         mimeType = mimeTypeTemp.split(";");
@@ -78,6 +134,11 @@ DesktopFile::DesktopFile(const QString &fileName)
     if (categories.first().compare("") == 0) {
         categories.removeFirst();
     }
+
+    QMutexLocker lk(&desktopFileCache->mutex);
+    if (desktopFileCache->files.size() >= kMaxCachedDesktopFiles)
+        desktopFileCache->files.clear();
+    desktopFileCache->files.insert(fileName, { modified, size, *this });
 }
 //---------------------------------------------------------------------------
 
@@ -139,6 +200,11 @@ QString DesktopFile::desktopDeepinVendor() const
     return deepinVendor;
 }
 
+QString DesktopFile::desktopCustomOpen() const
+{
+    return customOpen;
+}
+
 bool DesktopFile::isNoShow() const
 {
     return noDisplay || hidden;
@@ -157,3 +223,23 @@ QStringList DesktopFile::desktopMimeType() const
     return mimeType;
 }
 //---------------------------------------------------------------------------
+
+namespace dfmbase {
+
+QDataStream &operator<<(QDataStream &out, const DesktopFile &desktop)
+{
+    out << desktop.fileName << desktop.name << desktop.genericName << desktop.localName
+        << desktop.exec << desktop.icon << desktop.type << desktop.categories << desktop.mimeType
+        << desktop.deepinId << desktop.deepinVendor << desktop.customOpen << desktop.noDisplay << desktop.hidden;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, DesktopFile &desktop)
+{
+    in >> desktop.fileName >> desktop.name >> desktop.genericName >> desktop.localName
+            >> desktop.exec >> desktop.icon >> desktop.type >> desktop.categories >> desktop.mimeType
+            >> desktop.deepinId >> desktop.deepinVendor >> desktop.customOpen >> desktop.noDisplay >> desktop.hidden;
+    return in;
+}
+
+}
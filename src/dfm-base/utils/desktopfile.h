@@ -9,6 +9,8 @@
 
 #include <QStringList>
 
+class QDataStream;
+
 /**
  * @class DesktopFile
  * @brief Represents a linux desktop file
@@ -32,10 +34,14 @@ public:
     QString desktopType() const;
     QString desktopDeepinId() const;
     QString desktopDeepinVendor() const;
+    QString desktopCustomOpen() const;
     bool isNoShow() const;
     QStringList desktopCategories() const;
     QStringList desktopMimeType() const;
 
+    friend QDataStream &operator<<(QDataStream &out, const DesktopFile &desktop);
+    friend QDataStream &operator>>(QDataStream &in, DesktopFile &desktop);
+
 private:
     QString fileName;
     QString name;
@@ -48,6 +54,7 @@ private:
     QStringList mimeType;
     QString deepinId;
     QString deepinVendor;
+    QString customOpen;
     bool noDisplay = false;
     bool hidden = false;
 };
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "elidetextlayout.h"
+#include "elidetextlayoutcache.h"
 
 #include <QPainter>
 #include <QtMath>
@@ -17,16 +18,9 @@
 using namespace dfmbase;
 
 ElideTextLayout::ElideTextLayout(const QString &text)
-    : document(new QTextDocument)
+    : document(new QTextDocument), plainText(text)
 {
-    document->setPlainText(text);
-
-    attributes.insert(kFont, document->defaultFont());
-    attributes.insert(kLineHeight, QFontMetrics(document->defaultFont()).height());
-    attributes.insert(kBackgroundRadius, 0);
-    attributes.insert(kAlignment, Qt::AlignHCenter);
-    attributes.insert(kWrapMode, (uint)QTextOption::WrapAtWordBoundaryOrAnywhere);
-    attributes.insert(kTextDirection, Qt::LeftToRight);
+    initAttributes();
 }
 
 ElideTextLayout::~ElideTextLayout()
@@ -37,17 +31,74 @@ ElideTextLayout::~ElideTextLayout()
 
 void ElideTextLayout::setText(const QString &text)
 {
-    document->setPlainText(text);
+    plainText = text;
+    documentSynced = false;
 }
 
 QString ElideTextLayout::text() const
 {
-    return document->toPlainText();
+    return documentSynced ? document->toPlainText() : plainText;
+}
+
+void ElideTextLayout::reset(const QString &text)
+{
+    setText(text);
+    attributes.clear();
+    initAttributes();
+}
+
+void ElideTextLayout::initAttributes()
+{
+    attributes.insert(kFont, document->defaultFont());
+    attributes.insert(kLineHeight, QFontMetrics(document->defaultFont()).height());
+    attributes.insert(kBackgroundRadius, 0);
+    attributes.insert(kAlignment, Qt::AlignHCenter);
+    attributes.insert(kWrapMode, (uint)QTextOption::WrapAtWordBoundaryOrAnywhere);
+    attributes.insert(kTextDirection, Qt::LeftToRight);
+}
+
+void ElideTextLayout::syncDocument()
+{
+    if (documentSynced)
+        return;
+
+    document->setPlainText(plainText);
+    documentSynced = true;
 }
 
 QList<QRectF> ElideTextLayout::layout(const QRectF &rect, Qt::TextElideMode elideMode, QPainter *painter, const QBrush &background, QStringList *textLines)
 {
     QList<QRectF> ret;
+
+    // text objects are painted by custom handlers, they can not be cached.
+    QString key;
+    if (layoutCache && !text().contains(QChar::ObjectReplacementCharacter))
+        key = cacheKey(rect.size(), elideMode);
+
+    if (const ElideTextLayoutCache::Entry *hit = key.isEmpty() ? nullptr : layoutCache->find(key)) {
+        const QPointF delta = rect.topLeft() - hit->origin;
+        QRectF lastLineRect;
+        for (const auto &cachedLine : hit->lines) {
+            const QRectF &lRect = cachedLine.rect.translated(delta);
+            ret.append(lRect);
+            if (textLines)
+                textLines->append(cachedLine.text);
+
+            if (painter) {
+                if (background.style() != Qt::NoBrush)
+                    lastLineRect = drawLineBackground(painter, lRect, lastLineRect, background);
+
+                for (const auto &run : cachedLine.glyphRuns)
+                    painter->drawGlyphRun(delta, run);
+            }
+        }
+        return ret;
+    }
+
+    ElideTextLayoutCache::Entry cached;
+    cached.origin = rect.topLeft();
+
+    syncDocument();
     QTextLayout *lay = document->firstBlock().layout();
     if (!lay) {
         qCWarning(logDFMBase) << "invaild block" << document->firstBlock().text();
@@ -64,14 +115,18 @@ QList<QRectF> ElideTextLayout::layout(const QRectF &rect, Qt::TextElideMode elid
     QRectF lastLineRect;
     QString elideText;
     QString curText = text();
-    auto processLine = [this, &ret, painter, &lastLineRect, background, textLineHeight, &curText, textLines](QTextLine &line) {
+    const bool cacheLines = !key.isEmpty();
+    auto processLine = [this, &ret, painter, &lastLineRect, background, textLineHeight, &curText, textLines, cacheLines, &cached](QTextLine &line) {
         QRectF lRect = line.naturalTextRect();
         lRect.setHeight(textLineHeight);
 
         ret.append(lRect);
-        if (textLines) {
+        if (textLines || cacheLines) {
             const auto &t = curText.mid(line.textStart(), line.textLength());
-            textLines->append(t);
+            if (textLines)
+                textLines->append(t);
+            if (cacheLines)
+                cached.lines.append({ lRect, t, line.glyphRuns() });
         }
 
         // draw
@@ -140,6 +195,9 @@ QList<QRectF> ElideTextLayout::layout(const QRectF &rect, Qt::TextElideMode elid
         newlay.endLayout();
     }
 
+    if (cacheLines)
+        layoutCache->insert(key, cached);
+
     return ret;
 }
 
@@ -201,6 +259,20 @@ QRectF ElideTextLayout::drawLineBackground(QPainter *painter, const QRectF &curL
     return lastLineRect;
 }
 
+QString ElideTextLayout::cacheKey(const QSizeF &size, Qt::TextElideMode elideMode) const
+{
+    QString key = attribute<QFont>(kFont).key();
+    key += QChar('|') + QString::number(size.width()) + QChar('x') + QString::number(size.height());
+    key += QChar('|') + QString::number(attribute<int>(kLineHeight));
+    key += QChar('|') + QString::number(elideMode);
+    key += QChar('|') + QString::number(attribute<uint>(kAlignment));
+    key += QChar('|') + QString::number(attribute<uint>(kWrapMode));
+    key += QChar('|') + QString::number(attribute<Qt::LayoutDirection>(kTextDirection));
+    // text is the last one, so it can not be confused with the other fields.
+    key += QChar('|') + text();
+    return key;
+}
+
 void ElideTextLayout::initLayoutOption(QTextLayout *lay)
 {
     auto opt = lay->textOption();
@@ -15,6 +15,7 @@ class QTextLayout;
 
 namespace dfmbase {
 
+class ElideTextLayoutCache;
 class ElideTextLayout
 {
 public:
@@ -31,9 +32,16 @@ public:
     virtual ~ElideTextLayout();
     void setText(const QString &text);
     QString text() const;
+    // set \a text and the default attributes to reuse the layout for another item.
+    void reset(const QString &text);
+    // the lines of plain texts are looked up in and added to \a cache, it is not owned.
+    inline void setLayoutCache(ElideTextLayoutCache *cache) {
+        layoutCache = cache;
+    }
     QList<QRectF> layout(const QRectF &rect, Qt::TextElideMode elideMode, QPainter *painter = nullptr, const QBrush &background = Qt::NoBrush, QStringList *textLines = nullptr);
 public:
     inline QTextDocument *documentHandle() {
+        syncDocument();
         return document;
     }
 
@@ -49,9 +57,16 @@ public:
 protected:
     QRectF drawLineBackground(QPainter *painter, const QRectF &curLineRect, QRectF lastLineRect, const QBrush &brush) const;
     virtual void initLayoutOption(QTextLayout *lay);
+    QString cacheKey(const QSizeF &size, Qt::TextElideMode elideMode) const;
+    void initAttributes();
+    void syncDocument();
 protected:
     QTextDocument *document = nullptr;
     QMap<Attribute, QVariant> attributes;
+    // the document is filled on first use, the cached lines do not need it.
+    QString plainText;
+    bool documentSynced = false;
+    ElideTextLayoutCache *layoutCache = nullptr;
 };
 }
 
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "elidetextlayoutcache.h"
+
+#include <QGuiApplication>
+#include <QScreen>
+
+using namespace dfmbase;
+
+// about the visible items of a full screen view
+static constexpr int kMaxCachedLayouts = 1024;
+
+const ElideTextLayoutCache::Entry *ElideTextLayoutCache::find(const QString &key) const
+{
+    // QCache::object moves the hit entry to the front of the LRU list.
+    return cache.object(key);
+}
+
+void ElideTextLayoutCache::insert(const QString &key, const Entry &entry)
+{
+    cache.insert(key, new Entry(entry));
+}
+
+void ElideTextLayoutCache::clear()
+{
+    cache.clear();
+}
+
+ElideTextLayoutCache::ElideTextLayoutCache(QObject *parent)
+    : QObject(parent)
+{
+    cache.setMaxCost(kMaxCachedLayouts);
+
+    if (!qGuiApp)
+        return;
+
+    // glyphs are shaped with the font and dpi at layout time.
+    connect(qGuiApp, &QGuiApplication::fontChanged, this, &ElideTextLayoutCache::clear);
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, [this](QScreen *screen) {
+        watchScreen(screen);
+        clear();
+    });
+    connect(qGuiApp, &QGuiApplication::screenRemoved, this, &ElideTextLayoutCache::clear);
+
+    for (QScreen *screen : QGuiApplication::screens())
+        watchScreen(screen);
+}
+
+void ElideTextLayoutCache::watchScreen(QScreen *screen)
+{
+    if (!screen)
+        return;
+
+    connect(screen, &QScreen::logicalDotsPerInchChanged, this, &ElideTextLayoutCache::clear);
+    connect(screen, &QScreen::physicalDotsPerInchChanged, this, &ElideTextLayoutCache::clear);
+}
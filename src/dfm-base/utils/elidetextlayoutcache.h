@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ELIDETEXTLAYOUTCACHE_H
+#define ELIDETEXTLAYOUTCACHE_H
+
+#include <dfm-base/dfm_base_global.h>
+
+#include <QObject>
+#include <QCache>
+#include <QGlyphRun>
+#include <QRectF>
+
+class QScreen;
+
+namespace dfmbase {
+
+// the laid out lines of the texts painted by an item delegate, it is owned by the delegate.
+class ElideTextLayoutCache : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(ElideTextLayoutCache)
+
+public:
+    struct Line
+    {
+        QRectF rect;
+        QString text;
+        QList<QGlyphRun> glyphRuns;
+    };
+
+    // the laid out lines of a text, rects and glyph positions are relative to origin.
+    struct Entry
+    {
+        QPointF origin;
+        QList<Line> lines;
+    };
+
+    explicit ElideTextLayoutCache(QObject *parent = nullptr);
+
+    // the entry is valid until the next insert.
+    const Entry *find(const QString &key) const;
+    void insert(const QString &key, const Entry &entry);
+    void clear();
+
+private:
+    void watchScreen(QScreen *screen);
+
+private:
+    QCache<QString, Entry> cache;
+};
+
+}
+
+#endif   // ELIDETEXTLAYOUTCACHE_H
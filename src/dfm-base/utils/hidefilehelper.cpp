@@ -11,9 +11,50 @@
 #include <dfm-io/dfileinfo.h>
 
 #include <QSet>
+#include <QMap>
 #include <QFile>
+#include <QSaveFile>
+#include <QHash>
+#include <QMutex>
 #include <QDebug>
 
+#include <sys/stat.h>
+
+namespace {
+// a parsed .hidden file, or no .hidden file in the directory if it does not exist.
+struct HideListEntry
+{
+    bool exists = false;
+    quint64 ino = 0;
+    qint64 modified = 0;
+    qint64 size = 0;
+    QSet<QString> names;
+
+    bool isSameFile(const HideListEntry &other) const
+    {
+        return exists == other.exists && ino == other.ino
+                && modified == other.modified && size == other.size;
+    }
+};
+
+struct HideListCache
+{
+    QMutex mutex;
+    QHash<QString, HideListEntry> entries;
+};
+
+// drop all entries if too many directories were visited.
+constexpr int kMaxCachedHideLists = 10000;
+
+Q_GLOBAL_STATIC(HideListCache, hideListCache)
+
+QSet<QString> parseHideList(const QByteArray &data)
+{
+    const QString &dataStr = QString::fromLocal8Bit(data);
+    return QSet<QString>::fromList(dataStr.split('\n', QString::SkipEmptyParts));
+}
+}
+
 namespace dfmbase {
 class HideFileHelperPrivate
 {
@@ -39,14 +80,49 @@ public:
         if (!dfile)
             return;
 
+        if (dirUrl.isLocalFile()) {
+            hideList = HideFileHelper::hideListOf(dirUrl.toLocalFile());
+            hideListUpdate = hideList;
+            return;
+        }
+
         if (dfile->open(DFMIO::DFile::OpenFlag::kReadOnly)) {
-            const QByteArray &data = dfile->readAll();
-            const QString &dataStr = QString::fromLocal8Bit(data);
-            hideList = QSet<QString>::fromList(dataStr.split('\n', QString::SkipEmptyParts));
+            hideList = parseHideList(dfile->readAll());
             hideListUpdate = hideList;
             dfile->close();
         }
     }
+    bool write()
+    {
+        if (!dfile)
+            return false;
+
+        QStringList lines(hideList.toList());
+        QString dataStr = lines.join('\n');
+        QByteArray data;
+        data.append(dataStr);
+
+        if (dirUrl.isLocalFile()) {
+            // write a temporary file and rename it over .hidden, readers and
+            // watchers never see a truncated file
+            QSaveFile file(fileUrl.toLocalFile());
+            file.setDirectWriteFallback(true);
+            if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+                qCWarning(logDFMBase) << "write hidden file failed:" << fileUrl << file.errorString();
+                return false;
+            }
+            HideFileHelper::invalidateHideList(dirUrl.toLocalFile());
+            return true;
+        }
+
+        if (dfile->open(DFMIO::DFile::OpenFlag::kWriteOnly | DFMIO::DFile::OpenFlag::kTruncate)) {
+            dfile->write(data);
+            dfile->close();
+            return true;
+        }
+        return false;
+    }
+
     void updateAttribute()
     {
         for (const QString &name : hideListUpdate) {
@@ -100,21 +176,11 @@ QUrl HideFileHelper::fileUrl() const
 
 bool HideFileHelper::save() const
 {
-    if (!d->dfile)
+    if (!d->write())
         return false;
 
-    QStringList lines(d->hideList.toList());
-    QString dataStr = lines.join('\n');
-    QByteArray data;
-    data.append(dataStr);
-
-    if (d->dfile->open(DFMIO::DFile::OpenFlag::kWriteOnly | DFMIO::DFile::OpenFlag::kTruncate)) {
-        d->dfile->write(data);
-        d->dfile->close();
-        d->updateAttribute();
-        return true;
-    }
-    return false;
+    d->updateAttribute();
+    return true;
 }
 
 bool HideFileHelper::insert(const QString &name)
@@ -140,3 +206,87 @@ QSet<QString> HideFileHelper::hideFileList() const
 {
     return d->hideList;
 }
+
+/*!
+ * \brief the names in the .hidden file of \a dirPath, shared in process.
+ * the parsed file is reused until the .hidden file is changed, and a directory
+ * without .hidden file is cached too, so the file is opened at most once until it changes.
+ */
+QSet<QString> HideFileHelper::hideListOf(const QString &dirPath)
+{
+    const QString &filePath = dirPath.endsWith('/') ? dirPath + ".hidden" : dirPath + "/.hidden";
+    HideListEntry entry;
+    struct stat st;
+    if (::stat(QFile::encodeName(filePath).constData(), &st) == 0 && S_ISREG(st.st_mode)) {
+        entry.exists = true;
+        entry.ino = static_cast<quint64>(st.st_ino);
+        entry.modified = static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+        entry.size = static_cast<qint64>(st.st_size);
+    }
+
+    {
+        QMutexLocker lk(&hideListCache->mutex);
+        auto it = hideListCache->entries.constFind(dirPath);
+        if (it != hideListCache->entries.constEnd() && it->isSameFile(entry))
+            return it->names;
+    }
+
+    if (entry.exists && entry.size > 0) {
+        QFile file(filePath);
+        if (file.open(QIODevice::ReadOnly))
+            entry.names = parseHideList(file.readAll());
+    }
+
+    QMutexLocker lk(&hideListCache->mutex);
+    if (hideListCache->entries.size() >= kMaxCachedHideLists)
+        hideListCache->entries.clear();
+    hideListCache->entries.insert(dirPath, entry);
+    return entry.names;
+}
+
+/*!
+ * \brief drop the cached .hidden file of \a dirPath, such as the watcher reports it is changed.
+ */
+void HideFileHelper::invalidateHideList(const QString &dirPath)
+{
+    QMutexLocker lk(&hideListCache->mutex);
+    hideListCache->entries.remove(dirPath);
+}
+
+/*!
+ * \brief hide, unhide or toggle the hidden state of \a urls. the urls are grouped by
+ * their parent directory and each .hidden file is written once, the attributes that
+ * notify the watchers are updated after all .hidden files are written.
+ * \return false if any .hidden file could not be written.
+ */
+bool HideFileHelper::setFilesHidden(const QList<QUrl> &urls, HideAction action)
+{
+    QMap<QUrl, QStringList> namesOfDir;
+    for (const QUrl &url : urls) {
+        FileInfoPointer info = InfoFactory::create<FileInfo>(url);
+        if (info)
+            namesOfDir[info->urlOf(UrlInfoType::kParentUrl)].append(info->nameOf(NameInfoType::kFileName));
+    }
+
+    bool ok { true };
+    QList<QSharedPointer<HideFileHelper>> written;
+    for (auto it = namesOfDir.cbegin(); it != namesOfDir.cend(); ++it) {
+        QSharedPointer<HideFileHelper> helper(new HideFileHelper(it.key()));
+        for (const QString &name : it.value()) {
+            if (action == kHideAction || (action == kToggleAction && !helper->contains(name)))
+                helper->insert(name);
+            else
+                helper->remove(name);
+        }
+
+        if (helper->d->write())
+            written.append(helper);
+        else
+            ok = false;
+    }
+
+    for (const auto &helper : written)
+        helper->d->updateAttribute();
+
+    return ok;
+}
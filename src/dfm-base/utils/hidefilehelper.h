@@ -15,6 +15,12 @@ class HideFileHelperPrivate;
 class HideFileHelper
 {
 public:
+    enum HideAction : uint8_t {
+        kHideAction,
+        kUnhideAction,
+        kToggleAction
+    };
+
     explicit HideFileHelper(const QUrl &dir);
     ~HideFileHelper();
 
@@ -26,6 +32,10 @@ public:
     bool contains(const QString &name);
     QSet<QString> hideFileList() const;
 
+    static QSet<QString> hideListOf(const QString &dirPath);
+    static void invalidateHideList(const QString &dirPath);
+    static bool setFilesHidden(const QList<QUrl> &urls, HideAction action);
+
 private:
     QScopedPointer<HideFileHelperPrivate> d;
 };
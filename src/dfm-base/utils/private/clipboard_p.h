@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef CLIPBOARD_P_H
+#define CLIPBOARD_P_H
+
+#include <dfm-base/utils/clipboard.h>
+
+#include <QMimeData>
+#include <QHash>
+#include <QUrl>
+
+namespace dfmbase {
+
+/*!
+ * \brief The ClipBoardMimeData class holds the urls of a copy or cut
+ * and serialises each clipboard format only when a client asks for it,
+ * so publishing a large selection costs no more than sharing the list.
+ */
+class ClipBoardMimeData : public QMimeData
+{
+    Q_OBJECT
+
+public:
+    ClipBoardMimeData(const QList<QUrl> &urls, ClipBoard::ClipboardAction action);
+
+    QList<QUrl> clipboardUrls() const { return fileUrls; }
+    ClipBoard::ClipboardAction clipboardAction() const { return action; }
+
+    bool hasFormat(const QString &mimeType) const override;
+    QStringList formats() const override;
+
+protected:
+    QVariant retrieveData(const QString &mimeType, QVariant::Type type) const override;
+
+private:
+    QByteArray payload(const QString &mimeType) const;
+    QByteArray gnomeCopiedFiles() const;
+    QByteArray uriList() const;
+    QByteArray plainText() const;
+    QByteArray fileIcons() const;
+
+    const QList<QUrl> fileUrls;
+    const ClipBoard::ClipboardAction action;
+    QStringList lazyFormats;
+    mutable QHash<QString, QByteArray> payloads;
+};
+
+}   // namespace dfmbase
+
+#endif   // CLIPBOARD_P_H
@@ -97,10 +97,14 @@ bool SystemPathUtil::checkContainsSystemPath(const QList<QUrl> &urlList)
 {
     if (urlList.isEmpty())
         return false;
+
+    // resolve the bind mount of home once for the whole list, cleanPath
+    // would look it up again for every url
+    const QSet<QString> &paths = systemPathsWithBindPaths();
     if (urlList.first().scheme() == Global::Scheme::kFile)
-        return checkContainsSystemPathByFileUrl(urlList);
+        return checkContainsSystemPathByFileUrl(urlList, paths);
 
-    return checkContainsSystemPathByFileInfo(urlList);
+    return checkContainsSystemPathByFileInfo(urlList, paths);
 }
 
 SystemPathUtil::SystemPathUtil(QObject *parent)
@@ -165,9 +169,34 @@ void SystemPathUtil::cleanPath(QString *path) const
     }
 }
 
-bool SystemPathUtil::checkContainsSystemPathByFileInfo(const QList<QUrl> &urlList)
+QSet<QString> SystemPathUtil::systemPathsWithBindPaths() const
 {
+    static const QString &userHome = QStandardPaths::writableLocation(QStandardPaths::HomeLocation);
+    const QString &homeBindPath = FileUtils::bindPathTransform(userHome, true);
+
+    QSet<QString> paths { systemPathsSet };
+    if (homeBindPath == userHome)
+        return paths;
+
+    for (const QString &path : systemPathsSet) {
+        if (path.startsWith(userHome))
+            paths << homeBindPath + path.mid(userHome.length());
+    }
+    return paths;
+}
+
+bool SystemPathUtil::checkContainsSystemPathByFileInfo(const QList<QUrl> &urlList, const QSet<QString> &paths)
+{
+    // the virtual schemes redirect to a local file of the same name, so only
+    // urls named like a system path need a file info to resolve their target
+    QSet<QString> names;
+    for (const QString &path : paths)
+        names << path.mid(path.lastIndexOf('/') + 1);
+
     for (const auto &url : urlList) {
+        if (!names.contains(url.fileName()))
+            continue;
+
         auto info = InfoFactory::create<FileInfo>(url);
         if (info && isSystemPath(info->pathOf(PathInfoType::kAbsoluteFilePath)))
             return true;
@@ -176,10 +205,13 @@ bool SystemPathUtil::checkContainsSystemPathByFileInfo(const QList<QUrl> &urlLis
     return false;
 }
 
-bool SystemPathUtil::checkContainsSystemPathByFileUrl(const QList<QUrl> &urlList)
+bool SystemPathUtil::checkContainsSystemPathByFileUrl(const QList<QUrl> &urlList, const QSet<QString> &paths)
 {
-    return std::any_of(urlList.begin(), urlList.end(),[this](const QUrl &url){
-        return isSystemPath(url.path());
+    return std::any_of(urlList.begin(), urlList.end(), [&paths](const QUrl &url) {
+        QString path = url.path();
+        if (path.size() > 1 && path.endsWith('/'))
+            path.chop(1);
+        return paths.contains(path);
     });
 }
 
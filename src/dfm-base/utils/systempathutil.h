@@ -36,8 +36,9 @@ private:
     void initialize();
     void mkPath(const QString &path);
     void cleanPath(QString *path) const;
-    bool checkContainsSystemPathByFileInfo(const QList<QUrl> &urlList);
-    bool checkContainsSystemPathByFileUrl(const QList<QUrl> &urlList);
+    QSet<QString> systemPathsWithBindPaths() const;
+    bool checkContainsSystemPathByFileInfo(const QList<QUrl> &urlList, const QSet<QString> &paths);
+    bool checkContainsSystemPathByFileUrl(const QList<QUrl> &urlList, const QSet<QString> &paths);
 
 public:
     void loadSystemPaths();
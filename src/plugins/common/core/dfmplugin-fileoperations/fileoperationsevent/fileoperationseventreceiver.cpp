@@ -1378,19 +1378,8 @@ bool FileOperationsEventReceiver::handleOperationHideFiles(const quint64 windowI
 {
     Q_UNUSED(windowId)
 
-    bool ok { true };
-    for (const QUrl &url : urls) {
-        FileInfoPointer info = InfoFactory::create<FileInfo>(url);
-        if (info) {
-            const QUrl &parentUrl = info->urlOf(UrlInfoType::kParentUrl);
-            const QString &fileName = info->nameOf(NameInfoType::kFileName);
-
-            HideFileHelper helper(parentUrl);
-            helper.contains(fileName) ? helper.remove(fileName) : helper.insert(fileName);
-            if (!helper.save())
-                ok = false;
-        }
-    }
+    // one .hidden write per parent directory instead of one per file
+    bool ok = HideFileHelper::setFilesHidden(urls, HideFileHelper::kToggleAction);
 
     if (ok && !urls.isEmpty())
         FileUtils::notifyFileChangeManual(DFMGLOBAL_NAMESPACE::FileNotifyType::kFileChanged, urls.first());
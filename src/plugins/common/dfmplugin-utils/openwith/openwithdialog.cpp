@@ -393,9 +393,7 @@ void OpenWithDialog::initData()
                 isSameDesktop = true;
         }
 
-        Properties desktopInfo(f, "Desktop Entry");
-
-        const QString &customOpenDesktop = desktopInfo.value("X-DDE-File-Manager-Custom-Open").toString();
+        const QString &customOpenDesktop = app.desktopCustomOpen();
 
         // Filter self own desktop files for opening other types of files
         if (!customOpenDesktop.isEmpty() && customOpenDesktop != mimeType.name())
@@ -56,12 +56,17 @@ CanvasItemDelegatePrivate::~CanvasItemDelegatePrivate()
 {
 }
 
-ElideTextLayout *CanvasItemDelegatePrivate::createTextlayout(const QModelIndex &index, const QPainter *painter) const
+ElideTextLayout *CanvasItemDelegatePrivate::textLayout(const QModelIndex &index, const QPainter *painter) const
 {
     bool showSuffix = Application::instance()->genericAttribute(Application::kShowedFileSuffix).toBool();
     QString name = showSuffix ? index.data(Global::ItemRoles::kItemFileDisplayNameRole).toString()
                               : index.data(Global::ItemRoles::kItemFileBaseNameOfRenameRole).toString();
-    ElideTextLayout *layout = new ElideTextLayout(name);
+    if (layout.isNull()) {
+        layout.reset(new ElideTextLayout);
+        layout->setLayoutCache(&layoutCache);
+    }
+
+    layout->reset(name);
     layout->setAttribute(ElideTextLayout::kWrapMode, (uint)QTextOption::WrapAtWordBoundaryOrAnywhere);
     layout->setAttribute(ElideTextLayout::kLineHeight, textLineHeight);
     layout->setAttribute(ElideTextLayout::kAlignment, Qt::AlignHCenter);
@@ -71,7 +76,7 @@ ElideTextLayout *CanvasItemDelegatePrivate::createTextlayout(const QModelIndex &
         layout->setAttribute(ElideTextLayout::kTextDirection, painter->layoutDirection());
     }
 
-    return layout;
+    return layout.data();
 }
 
 bool CanvasItemDelegatePrivate::needExpend(const QStyleOptionViewItem &option, const QModelIndex &index, const QRect &rText, QRect *needText) const
@@ -399,9 +404,9 @@ Qt::Alignment CanvasItemDelegate::visualAlignment(Qt::LayoutDirection direction,
 QList<QRectF> CanvasItemDelegate::elideTextRect(const QModelIndex &index, const QRect &rect, const Qt::TextElideMode &elideMode) const
 {
     // create text Layout.
-    QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index));
+    ElideTextLayout *layout = d->textLayout(index);
 
-    d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+    d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
     // elide mode
     auto textLines = layout->layout(rect, elideMode);
@@ -416,7 +421,7 @@ bool CanvasItemDelegate::isTransparent(const QModelIndex &index) const
         if (!file.get())
             return false;
 
-        if (ClipBoard::instance()->clipboardFileUrlList().contains(file->urlOf(UrlInfoType::kUrl)))
+        if (ClipBoard::instance()->isCut(file->urlOf(UrlInfoType::kUrl)))
             return true;
     }
     return false;
@@ -454,9 +459,9 @@ void CanvasItemDelegate::drawNormlText(QPainter *painter, const QStyleOptionView
         p.setFont(painter->font());
 
         // create text Layout.
-        QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, &p));
+        ElideTextLayout *layout = d->textLayout(index, &p);
 
-        d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+        d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
         // elide and draw
         layout->layout(QRectF(QPoint(0, 0), QSizeF(textImage.size()) / pixelRatio), option.textElideMode, &p);
@@ -496,10 +501,10 @@ void CanvasItemDelegate::drawHighlightText(QPainter *painter, const QStyleOption
         auto background = option.palette.brush(QPalette::Normal, QPalette::Highlight);
 
         // create text Layout.
-        QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, painter));
+        ElideTextLayout *layout = d->textLayout(index, painter);
         layout->setAttribute(ElideTextLayout::kBackgroundRadius, kIconRectRadius);
 
-        d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+        d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
         // elide and draw
         layout->layout(rText, option.textElideMode, painter, background);
@@ -514,10 +519,10 @@ void CanvasItemDelegate::drawExpandText(QPainter *painter, const QStyleOptionVie
     auto background = option.palette.brush(QPalette::Normal, QPalette::Highlight);
 
     // create text Layout.
-    QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, painter));
+    ElideTextLayout *layout = d->textLayout(index, painter);
     layout->setAttribute(ElideTextLayout::kBackgroundRadius, kIconRectRadius);
 
-    d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+    d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
     // elide and draw
     layout->layout(rect, option.textElideMode, painter, background);
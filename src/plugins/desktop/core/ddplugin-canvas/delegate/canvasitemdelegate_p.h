@@ -8,6 +8,7 @@
 #include "canvasitemdelegate.h"
 
 #include <dfm-base/utils/elidetextlayout.h>
+#include <dfm-base/utils/elidetextlayoutcache.h>
 
 #include <QPointer>
 #include <QTextDocument>
@@ -21,7 +22,8 @@ public:
     explicit CanvasItemDelegatePrivate(CanvasItemDelegate *qq);
     ~CanvasItemDelegatePrivate();
 
-    dfmbase::ElideTextLayout *createTextlayout(const QModelIndex &index, const QPainter *painter = nullptr) const;
+    // the layout is reused by every paint, it is valid until the next call.
+    dfmbase::ElideTextLayout *textLayout(const QModelIndex &index, const QPainter *painter = nullptr) const;
 
     inline QRect availableTextRect(QRect labelRect) const
     {
@@ -44,6 +46,8 @@ public:
     // default icon size is 48px.
     int currentIconLevel = -1;
     int textLineHeight = -1;
+    mutable dfmbase::ElideTextLayoutCache layoutCache;
+    mutable QScopedPointer<dfmbase::ElideTextLayout> layout;
     QList<int> iconSizes;
     QSize itemSizeHint;
 
@@ -38,6 +38,7 @@ void CanvasGrid::initSurface(int count)
     d->surfaces.clear();
     for (int i = 1; i <= count; ++i)
         d->surfaces.insert(i, QSize(0, 0));
+    d->invalidOccupancy();
 }
 
 void CanvasGrid::updateSize(int index, const QSize &size)
@@ -63,12 +64,14 @@ void CanvasGrid::updateSize(int index, const QSize &size)
 
         //update surface size
         itor.value() = size;
+        d->invalidOccupancy(index);
 
         // rearrange all items
         setItems(allItems);
     } else {
         // just update surface size
         itor.value() = size;
+        d->invalidOccupancy(index);
     }
 }
 
@@ -331,6 +334,7 @@ void CanvasGridPrivate::clean()
     posItem.clear();
     itemPos.clear();
     overload.clear();
+    invalidOccupancy();
 }
 
 void CanvasGridPrivate::sequence(QStringList sortedItems)
@@ -356,6 +360,7 @@ void CanvasGridPrivate::sequence(QStringList sortedItems)
 
         itemPos.insert(idx, allItem);
         posItem.insert(idx, allPos);
+        invalidOccupancy(idx);
     }
     fmDebug() << "overload items " << sortedItems.size();
     overload = sortedItems;
@@ -5,20 +5,78 @@
 #include "gridcore.h"
 #include "displayconfig.h"
 
+#include <QtAlgorithms>
+
 uint qHash(const QPoint &key, uint seed)
 {
-    QString val = QString("%1x%2").arg(key.x()).arg(key.y());
-    return qHash<QString>(val, seed);
+    return qHash((quint64(quint32(key.x())) << 32) | quint32(key.y()), seed);
 }
 
 using namespace ddplugin_canvas;
 
+static constexpr int kWordBits = 64;
+
+GridOccupancy::GridOccupancy(const QSize &size, const QHash<QPoint, QString> &usedPos)
+    : width(qMax(size.width(), 0)), height(qMax(size.height(), 0))
+{
+    bits.fill(0, (cellCount() + kWordBits - 1) / kWordBits);
+    for (auto itor = usedPos.begin(); itor != usedPos.end(); ++itor)
+        setUsed(itor.key(), true);
+}
+
+void GridOccupancy::setUsed(const QPoint &pos, bool use)
+{
+    if (!CanvasGridSpecialist::isValid(pos, QSize(width, height)))
+        return;
+
+    const int c = cell(pos);
+    quint64 &word = bits[c / kWordBits];
+    const quint64 mask = quint64(1) << (c % kWordBits);
+    if (bool(word & mask) == use)
+        return;
+
+    if (use) {
+        word |= mask;
+        ++used;
+    } else {
+        word &= ~mask;
+        --used;
+        voidHint = qMin(voidHint, c);
+    }
+}
+
+int GridOccupancy::nextVoid(int from) const
+{
+    const int count = cellCount();
+    const bool fromHead = from <= voidHint;
+    from = qMax(from, voidHint);
+    if (from >= count || used >= count)
+        return -1;
+
+    int wordIdx = from / kWordBits;
+    // treat the cells before \a from as used.
+    quint64 word = bits.at(wordIdx) | ((quint64(1) << (from % kWordBits)) - 1);
+    while (word == ~quint64(0)) {
+        if (++wordIdx >= bits.size())
+            return -1;
+        word = bits.at(wordIdx);
+    }
+
+    const int c = wordIdx * kWordBits + int(qCountTrailingZeroBits(~word));
+    if (c >= count)
+        return -1;
+
+    if (fromHead)
+        voidHint = c;
+    return c;
+}
+
 GridCore::GridCore()
 {
 }
 
 GridCore::GridCore(const GridCore &other)
-    : surfaces(other.surfaces), posItem(other.posItem), itemPos(other.itemPos), overload(other.overload)
+    : surfaces(other.surfaces), posItem(other.posItem), itemPos(other.itemPos), overload(other.overload), occupancy(other.occupancy)
 {
 }
 
@@ -44,38 +102,40 @@ bool GridCore::applay(GridCore *core)
     posItem = core->posItem;
     itemPos = core->itemPos;
     overload = core->overload;
+    occupancy = core->occupancy;
     return true;
 }
 
 void GridCore::insert(int index, const QPoint &pos, const QString &it)
 {
+    const bool replaced = posItem.value(index).contains(pos);
     itemPos[index].insert(it, pos);
     posItem[index].insert(pos, it);
+    if (!replaced)
+        updateOccupancy(index, pos, true);
 }
 
 void GridCore::remove(int index, const QString &it)
 {
     auto pos = itemPos[index].take(it);
-    posItem[index].remove(pos);
+    if (posItem[index].remove(pos) > 0)
+        updateOccupancy(index, pos, false);
 }
 
 void GridCore::remove(int index, const QPoint &pos)
 {
+    const bool existed = posItem.value(index).contains(pos);
     QString it = posItem[index].take(pos);
     itemPos[index].remove(it);
+    if (existed)
+        updateOccupancy(index, pos, false);
 }
 
 QList<QPoint> GridCore::voidPos(int index) const
 {
     QList<QPoint> ret;
-    const QSize &size = surfaces.value(index, QSize(0, 0));
-    const QHash<QPoint, QString> &usedPos = posItem.value(index);
-    for (int x = 0; x < size.width(); ++x)
-        for (int y = 0; y < size.height(); ++y) {
-            QPoint pos(x, y);
-            if (!usedPos.contains(pos))
-                ret.append(pos);
-        }
+    for (int cell = nextVoidCell(index, 0); cell >= 0; cell = nextVoidCell(index, cell + 1))
+        ret.append(cellPos(index, cell));
 
     return ret;
 }
@@ -83,23 +143,17 @@ QList<QPoint> GridCore::voidPos(int index) const
 bool GridCore::findVoidPos(GridPos &pos) const
 {
     for (int idx : surfaceIndex()) {
-        const QHash<QPoint, QString> &usedPos = posItem.value(idx);
-        const QSize &size = surfaces.value(idx);
-
         // no void pos
         if (isFull(idx))
             continue;
 
         // find first void pos.
-        for (int x = 0; x < size.width(); ++x)
-            for (int y = 0; y < size.height(); ++y) {
-                QPoint curPos(x, y);
-                if (!usedPos.contains(curPos)) {
-                    pos.first = idx;
-                    pos.second = curPos;
-                    return true;
-                }
-            }
+        int cell = nextVoidCell(idx, 0);
+        if (cell >= 0) {
+            pos.first = idx;
+            pos.second = cellPos(idx, cell);
+            return true;
+        }
     }
 
     return false;
@@ -143,11 +197,41 @@ void GridCore::removeAll(const QStringList &items)
             if (!itemPos[index].contains(it))
                 continue;
             auto pos = itemPos[index].take(it);
-            posItem[index].remove(pos);
+            if (posItem[index].remove(pos) > 0)
+                updateOccupancy(index, pos, false);
         }
     }
 }
 
+int GridCore::nextVoidCell(int index, int from) const
+{
+    return occupancyOf(index).nextVoid(qMax(from, 0));
+}
+
+QPoint GridCore::cellPos(int index, int cell) const
+{
+    return occupancyOf(index).pos(cell);
+}
+
+GridOccupancy &GridCore::occupancyOf(int index) const
+{
+    auto itor = occupancy.find(index);
+    if (itor == occupancy.end())
+        itor = occupancy.insert(index, GridOccupancy(surfaces.value(index, QSize(0, 0)), posItem.value(index)));
+
+    return itor.value();
+}
+
+void GridCore::updateOccupancy(int index, const QPoint &pos, bool use)
+{
+    auto itor = occupancy.find(index);
+    if (itor == occupancy.end())
+        return;
+
+    // keep the occupancy in step, or it is built when next used.
+    itor.value().setUsed(pos, use);
+}
+
 MoveGridOper::MoveGridOper(GridCore *core)
     : GridCore(*core)
 {
@@ -245,18 +329,17 @@ QStringList AppendOper::appendAfter(QStringList items, int index, const QPoint &
     if (items.isEmpty())
         return items;
 
-    QList<QPoint> posList = voidPos(index);
-    for (const QPoint &pos : posList) {
-        if ((pos.x() > begin.x())
-            || (pos.x() == begin.x() && pos.y() >= begin.y())
-            || DisplayConfig::instance()->autoAlign()) {
-            // all items is appenped
-            if (items.isEmpty())
-                return items;
+    // the void cells at or after \a begin in column-major order.
+    int from = 0;
+    if (!DisplayConfig::instance()->autoAlign()) {
+        const QSize &size = surfaceSize(index);
+        from = begin.x() * size.height() + qBound(0, begin.y(), size.height());
+    }
 
-            QString &&item = items.takeFirst();
-            insert(index, pos, item);
-        }
+    for (int cell = nextVoidCell(index, from); cell >= 0 && !items.isEmpty();
+         cell = nextVoidCell(index, cell + 1)) {
+        QString &&item = items.takeFirst();
+        insert(index, cellPos(index, cell), item);
     }
 
     return items;
@@ -265,14 +348,13 @@ QStringList AppendOper::appendAfter(QStringList items, int index, const QPoint &
 void AppendOper::append(QStringList items)
 {
     for (int idx : surfaceIndex()) {
-        auto posList = voidPos(idx);
-        for (const QPoint &pos : posList) {
+        for (int cell = nextVoidCell(idx, 0); cell >= 0; cell = nextVoidCell(idx, cell + 1)) {
             // all items is appenped
             if (items.isEmpty())
                 return;
 
             QString &&it = items.takeFirst();
-            insert(idx, pos, it);
+            insert(idx, cellPos(idx, cell), it);
         }
     }
 
@@ -9,12 +9,40 @@
 
 #include <QMap>
 #include <QSize>
+#include <QVector>
 
 extern uint qHash(const QPoint &key, uint seed);
 
 namespace ddplugin_canvas {
 
 typedef QPair<int, QPoint> GridPos;
+
+// occupied cells of a surface, cells are indexed in column-major order as the grid is filled.
+class GridOccupancy
+{
+public:
+    GridOccupancy() = default;
+    explicit GridOccupancy(const QSize &size, const QHash<QPoint, QString> &usedPos);
+    inline int cellCount() const {
+        return width * height;
+    }
+    inline int cell(const QPoint &pos) const {
+        return pos.x() * height + pos.y();
+    }
+    inline QPoint pos(int cell) const {
+        return QPoint(cell / height, cell % height);
+    }
+    void setUsed(const QPoint &pos, bool use);
+    int nextVoid(int from) const;
+
+private:
+    int width = 0;
+    int height = 0;
+    int used = 0;
+    QVector<quint64> bits;
+    mutable int voidHint = 0;   // there is no void cell before it.
+};
+
 class GridCore
 {
 protected:
@@ -50,11 +78,28 @@ public:
     inline void pushOverload(const QStringList &items){
         overload.append(items);
     }
+
+    // must be called after posItem or surfaces are changed without GridCore.
+    inline void invalidOccupancy() {
+        occupancy.clear();
+    }
+    inline void invalidOccupancy(int index) {
+        occupancy.remove(index);
+    }
+protected:
+    int nextVoidCell(int index, int from) const;
+    QPoint cellPos(int index, int cell) const;
+private:
+    GridOccupancy &occupancyOf(int index) const;
+    void updateOccupancy(int index, const QPoint &pos, bool use);
 public:
     QMap<int, QSize> surfaces;
     QMap<int, QHash<QPoint, QString>> posItem;
     QMap<int, QHash<QString, QPoint>> itemPos;
     QStringList overload;
+private:
+    // built from posItem on demand and kept in step by GridCore, see invalidOccupancy.
+    mutable QMap<int, GridOccupancy> occupancy;
 };
 
 class MoveGridOper : public GridCore
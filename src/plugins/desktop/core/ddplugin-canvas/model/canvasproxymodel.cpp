@@ -71,8 +71,10 @@ void CanvasProxyModelPrivate::sourceRowsInserted(const QModelIndex &sourceParent
     q->beginInsertRows(q->rootIndex(), row, row + files.count() - 1);
 
     fileList.append(files);
-    for (const QUrl &url : files)
+    for (const QUrl &url : files) {
         fileMap.insert(url, srcModel->fileInfo(srcModel->index(url)));
+        rowIndex.inserted(url, row++);
+    }
 
     q->endInsertRows();
 }
@@ -98,13 +100,14 @@ void CanvasProxyModelPrivate::sourceRowsAboutToBeRemoved(const QModelIndex &sour
 
     // remove one by one
     for (const QUrl &url : files) {
-        int row = fileList.indexOf(url);
+        int row = rowOf(url);
         if (row < 0)
             continue;
 
         q->beginRemoveRows(q->rootIndex(), row, row);
         fileList.removeAt(row);
         fileMap.remove(url);
+        rowIndex.removed(url, row);
         q->endRemoveRows();
     }
 }
@@ -114,12 +117,13 @@ void CanvasProxyModelPrivate::sourceDataRenamed(const QUrl &oldUrl, const QUrl &
     // canvas filter
     bool ignore = renameFilter(oldUrl, newUrl);
 
-    int row = fileList.indexOf(oldUrl);
+    int row = rowOf(oldUrl);
     if (ignore) {
         if (row >= 0) {
             q->beginRemoveRows(q->rootIndex(), row, row);
             fileList.removeAt(row);
             fileMap.remove(oldUrl);
+            rowIndex.removed(oldUrl, row);
             q->endRemoveRows();
         }
         return;
@@ -132,6 +136,7 @@ void CanvasProxyModelPrivate::sourceDataRenamed(const QUrl &oldUrl, const QUrl &
             q->beginInsertRows(q->rootIndex(), row, row);
             fileList.append(newUrl);
             fileMap.insert(newUrl, newInfo);
+            rowIndex.inserted(newUrl, row);
             q->endInsertRows();
             return;
         }
@@ -142,13 +147,15 @@ void CanvasProxyModelPrivate::sourceDataRenamed(const QUrl &oldUrl, const QUrl &
             q->beginRemoveRows(q->rootIndex(), row, row);
             fileList.removeAt(row);
             fileMap.remove(oldUrl);
+            rowIndex.removed(oldUrl, row);
             q->endRemoveRows();
 
-            row = fileList.indexOf(newUrl);
+            row = rowOf(newUrl);
         } else {
             fileList.replace(row, newUrl);
             fileMap.remove(oldUrl);
             fileMap.insert(newUrl, newInfo);
+            rowIndex.replaced(oldUrl, newUrl, row);
             emit q->dataReplaced(oldUrl, newUrl);
         }
 
@@ -332,6 +339,7 @@ void CanvasProxyModelPrivate::clearMapping()
 {
     fileList.clear();
     fileMap.clear();
+    rowIndex.clear();
 }
 
 void CanvasProxyModelPrivate::createMapping()
@@ -352,6 +360,7 @@ void CanvasProxyModelPrivate::createMapping()
     // set unsorted files into model to enable create module index that doSort will used.
     fileList = urls;
     fileMap = maps;
+    rowIndex.reset(fileList);
 
     doSort(urls);
 
@@ -364,6 +373,7 @@ void CanvasProxyModelPrivate::createMapping()
 
     fileList = urls;
     fileMap = maps;
+    rowIndex.reset(fileList);
 }
 
 QModelIndexList CanvasProxyModelPrivate::indexs() const
@@ -376,6 +386,15 @@ QModelIndexList CanvasProxyModelPrivate::indexs() const
     return results;
 }
 
+int CanvasProxyModelPrivate::rowOf(const QUrl &url) const
+{
+    // the index only knows the urls in fileList, check it by fileMap to avoid searching the list.
+    if (!fileMap.contains(url))
+        return -1;
+
+    return rowIndex.row(fileList, url);
+}
+
 QModelIndexList CanvasProxyModelPrivate::indexs(const QList<QUrl> &files) const
 {
     QModelIndexList idxs;
@@ -470,10 +489,9 @@ QModelIndex CanvasProxyModel::index(const QUrl &url, int column) const
     if (!url.isValid())
         return QModelIndex();
 
-    if (d->fileMap.contains(url)) {
-        int row = d->fileList.indexOf(url);
+    int row = d->rowOf(url);
+    if (row >= 0)
         return createIndex(row, column);
-    }
 
     return QModelIndex();
 }
@@ -815,6 +833,7 @@ bool CanvasProxyModel::sort()
 
         d->fileList = orderFiles;
         d->fileMap = tempFileMap;
+        d->rowIndex.reset(d->fileList);
 
         // get the indexs of fromUlrs after sorting
         QModelIndexList to = d->indexs(fromUlrs);
@@ -881,6 +900,7 @@ bool CanvasProxyModel::fetch(const QUrl &url)
 
         d->fileList.append(url);
         d->fileMap.insert(url, info);
+        d->rowIndex.inserted(url, row);
 
         endInsertRows();
         return true;
@@ -898,7 +918,7 @@ bool CanvasProxyModel::take(const QUrl &url)
     // canvas filter
     d->removeFilter(url);
 
-    int row = d->fileList.indexOf(url);
+    int row = d->rowOf(url);
     if (Q_UNLIKELY(row < 0)) {
         fmCritical() << "invaild index of" << url;
         return false;
@@ -907,6 +927,7 @@ bool CanvasProxyModel::take(const QUrl &url)
     beginRemoveRows(rootIndex(), row, row);
     d->fileList.removeAt(row);
     d->fileMap.remove(url);
+    d->rowIndex.removed(url, row);
     endRemoveRows();
     return true;
 }
@@ -9,6 +9,7 @@
 #include "fileinfomodel.h"
 #include "modelhookinterface.h"
 #include "canvasmodelfilter.h"
+#include "urlrowindex.h"
 
 #include <dfm-base/dfm_global_defines.h>
 
@@ -27,6 +28,7 @@ public:
     QModelIndexList indexs(const QList<QUrl> &files) const;
     bool doSort(QList<QUrl> &files) const;
     bool lessThan(const QUrl &left, const QUrl &right) const;
+    int rowOf(const QUrl &url) const;
 public slots:
     void doRefresh(bool global, bool updateFile);
     void sourceDataChanged(const QModelIndex &sourceTopleft,
@@ -60,6 +62,7 @@ public:
     QDir::Filters filters = QDir::AllEntries | QDir::NoDotAndDotDot | QDir::System;
     QList<QUrl> fileList;
     QMap<QUrl, FileInfoPointer> fileMap;
+    UrlRowIndex rowIndex;
     FileInfoModel *srcModel = nullptr;
     QSharedPointer<QTimer> refreshTimer;
     int fileSortRole = DFMGLOBAL_NAMESPACE::ItemRoles::kItemFileMimeTypeRole;
@@ -49,6 +49,15 @@ QIcon FileInfoModelPrivate::fileIcon(FileInfoPointer info)
     return info->fileIcon();
 }
 
+int FileInfoModelPrivate::rowOf(const QUrl &url) const
+{
+    // the index only knows the urls in fileList, check it by fileMap to avoid searching the list.
+    if (!fileMap.contains(url))
+        return -1;
+
+    return rowIndex.row(fileList, url);
+}
+
 void FileInfoModelPrivate::resetData(const QList<QUrl> &urls)
 {
     fmDebug() << "to reset file, count:" << urls.size();
@@ -66,6 +75,7 @@ void FileInfoModelPrivate::resetData(const QList<QUrl> &urls)
         QWriteLocker lk(&lock);
         fileList = fileUrls;
         fileMap = fileMaps;
+        rowIndex.reset(fileList);
     }
 
     modelState = FileInfoModelPrivate::NormalState;
@@ -99,6 +109,7 @@ void FileInfoModelPrivate::insertData(const QUrl &url)
         QWriteLocker lk(&lock);
         fileList.append(url);
         fileMap.insert(url, itemInfo);
+        rowIndex.inserted(url, fileList.count() - 1);
     }
     q->endInsertRows();
 }
@@ -108,7 +119,7 @@ void FileInfoModelPrivate::removeData(const QUrl &url)
     int position = -1;
     {
         QReadLocker lk(&lock);
-        position = fileList.indexOf(url);
+        position = rowOf(url);
     }
 
     if (Q_UNLIKELY(position < 0)) {
@@ -119,9 +130,10 @@ void FileInfoModelPrivate::removeData(const QUrl &url)
     q->beginRemoveRows(q->rootIndex(), position, position);
     {
         QWriteLocker lk(&lock);
-        position = fileList.indexOf(url);
+        position = rowOf(url);
         fileList.removeAt(position);
         fileMap.remove(url);
+        rowIndex.removed(url, position);
     }
     q->endRemoveRows();
 }
@@ -145,7 +157,7 @@ void FileInfoModelPrivate::replaceData(const QUrl &oldUrl, const QUrl &newUrl)
 
     {
         QWriteLocker lk(&lock);
-        int position = fileList.indexOf(oldUrl);
+        int position = rowOf(oldUrl);
         if (Q_LIKELY(position < 0)) {
             if (!fileMap.contains(newUrl)) {
                 lk.unlock();
@@ -153,7 +165,7 @@ void FileInfoModelPrivate::replaceData(const QUrl &oldUrl, const QUrl &newUrl)
                 return;
             }
         } else {
-            if (fileList.contains(newUrl)) {
+            if (fileMap.contains(newUrl)) {
                 // e.g. a mv to b(b is existed)
                 //! emit replace signal first.
                 emit q->dataReplaced(oldUrl, newUrl);
@@ -162,7 +174,7 @@ void FileInfoModelPrivate::replaceData(const QUrl &oldUrl, const QUrl &newUrl)
                 lk.unlock();
                 removeData(oldUrl);
                 lk.relock();
-                position = fileList.indexOf(newUrl);
+                position = rowOf(newUrl);
                 auto cur = fileMap.value(newUrl);
                 lk.unlock();
 
@@ -173,6 +185,7 @@ void FileInfoModelPrivate::replaceData(const QUrl &oldUrl, const QUrl &newUrl)
                 fileList.replace(position, newUrl);
                 fileMap.remove(oldUrl);
                 fileMap.insert(newUrl, newInfo);
+                rowIndex.replaced(oldUrl, newUrl, position);
                 lk.unlock();
 
                 // refresh file because an old info cahe may exist.
@@ -328,10 +341,9 @@ QModelIndex FileInfoModel::index(const QUrl &url, int column) const
     if (url.isEmpty())
         return QModelIndex();
 
-    if (d->fileMap.contains(url)) {
-        int row = d->fileList.indexOf(url);
+    int row = d->rowOf(url);
+    if (row >= 0)
         return createIndex(row, column);
-    }
 
     if (url == rootUrl())
         return rootIndex();
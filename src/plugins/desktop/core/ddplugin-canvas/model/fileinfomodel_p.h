@@ -7,6 +7,7 @@
 
 #include "fileinfomodel.h"
 #include "fileprovider.h"
+#include "urlrowindex.h"
 
 #include <QReadWriteLock>
 
@@ -24,6 +25,7 @@ public:
     explicit FileInfoModelPrivate(FileInfoModel *qq);
     void doRefresh();
     QIcon fileIcon(FileInfoPointer info);
+    int rowOf(const QUrl &url) const;
 
 public slots:
     void resetData(const QList<QUrl> &urls);
@@ -40,6 +42,7 @@ public:
     FileProvider *fileProvider = nullptr;
     QList<QUrl> fileList;
     QMap<QUrl, FileInfoPointer> fileMap;
+    UrlRowIndex rowIndex;
     QReadWriteLock lock;
 
 private:
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "urlrowindex.h"
+
+using namespace ddplugin_canvas;
+
+int UrlRowIndex::row(const QList<QUrl> &list, const QUrl &url) const
+{
+    auto it = slots.constFind(url);
+    if (it != slots.constEnd()) {
+        const int r = liveBefore(it.value());
+        if (r < list.size() && list.at(r) == url)
+            return r;
+    }
+
+    // the list is changed without notifying.
+    return list.indexOf(url);
+}
+
+void UrlRowIndex::reset(const QList<QUrl> &list)
+{
+    const int count = list.size();
+    slots.clear();
+    slots.reserve(count);
+    tree.fill(0, count + 1);
+    for (int i = 0; i < count; ++i) {
+        slots.insert(list.at(i), i);
+        // every slot is live, the node covers lowbit(i + 1) of them.
+        tree[i + 1] = (i + 1) & -(i + 1);
+    }
+}
+
+void UrlRowIndex::clear()
+{
+    slots.clear();
+    tree.fill(0, 1);
+}
+
+void UrlRowIndex::inserted(const QUrl &url, int row)
+{
+    Q_UNUSED(row)
+    if (slots.contains(url))
+        removed(url, -1);
+
+    // append a node, it covers the slots (n - lowbit(n), n].
+    const int n = tree.size();
+    const int covered = n & -n;
+    tree.append(1 + liveBefore(n - 1) - liveBefore(n - covered));
+    slots.insert(url, n - 1);
+}
+
+void UrlRowIndex::removed(const QUrl &url, int row)
+{
+    Q_UNUSED(row)
+    auto it = slots.find(url);
+    if (it == slots.end())
+        return;
+
+    for (int i = it.value() + 1; i < tree.size(); i += i & -i)
+        --tree[i];
+    slots.erase(it);
+}
+
+void UrlRowIndex::replaced(const QUrl &oldUrl, const QUrl &newUrl, int row)
+{
+    auto it = slots.find(oldUrl);
+    if (it == slots.end()) {
+        inserted(newUrl, row);
+        return;
+    }
+
+    const int slot = it.value();
+    slots.erase(it);
+    slots.insert(newUrl, slot);
+}
+
+// the count of live slots in [0, slot)
+int UrlRowIndex::liveBefore(int slot) const
+{
+    int count = 0;
+    for (int i = slot; i > 0; i -= i & -i)
+        count += tree.at(i);
+    return count;
+}
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef URLROWINDEX_H
+#define URLROWINDEX_H
+
+#include "ddplugin_canvas_global.h"
+
+#include <QHash>
+#include <QList>
+#include <QUrl>
+#include <QVector>
+
+namespace ddplugin_canvas {
+
+// maps the url to its row in a url list that owned by a model.
+// each url holds the slot it was appended to, and its row is the count of the
+// live slots before it, kept in a fenwick tree. so appending, removing and
+// looking up are O(log n) and a lookup never modifies the index, which makes it
+// safe under a read lock. the list may only grow at the end between resets.
+class UrlRowIndex
+{
+public:
+    // falls back to search \a list if the list is changed without notifying.
+    int row(const QList<QUrl> &list, const QUrl &url) const;
+    void reset(const QList<QUrl> &list);
+    void clear();
+    // \a row must be the end of the list.
+    void inserted(const QUrl &url, int row);
+    void removed(const QUrl &url, int row);
+    void replaced(const QUrl &oldUrl, const QUrl &newUrl, int row);
+protected:
+    int liveBefore(int slot) const;
+private:
+    QHash<QUrl, int> slots;
+    // 1-based fenwick tree of the live slots.
+    QVector<int> tree { 0 };
+};
+
+}
+
+#endif   // URLROWINDEX_H
@@ -195,9 +195,9 @@ CollectionBaseDataPtr OrganizerConfig::collectionBase(bool custom, const QString
     d->settings->beginGroup(kGroupCollectionBase);
     d->settings->beginGroup(key);
 
-    CollectionBaseDataPtr base(new CollectionBaseData);
-    base->name = d->settings->value(kKeyName, "").toString();
-    base->key = d->settings->value(kKeyKey, "").toString();
+    QList<QUrl> items;
+    const QString name = d->settings->value(kKeyName, "").toString();
+    const QString baseKey = d->settings->value(kKeyKey, "").toString();
 
     {
         d->settings->beginGroup(kGroupItems);
@@ -210,7 +210,7 @@ CollectionBaseDataPtr OrganizerConfig::collectionBase(bool custom, const QString
         for (const QString &index : keys) {
             QUrl url = d->settings->value(index).toString();
             if (url.isValid())
-                base->items.append(url);
+                items.append(url);
         }
 
         d->settings->endGroup();
@@ -220,6 +220,10 @@ CollectionBaseDataPtr OrganizerConfig::collectionBase(bool custom, const QString
     d->settings->endGroup();
     d->settings->endGroup();
 
+    CollectionBaseDataPtr base(new CollectionBaseData(items));
+    base->name = name;
+    base->key = baseKey;
+
     if (key != base->key || base->key.isEmpty() || base->name.isEmpty()) {
         fmWarning() << "invalid collection base" << key << base->key;
         base.clear();
@@ -242,7 +246,7 @@ void OrganizerConfig::updateCollectionBase(bool custom, const CollectionBaseData
         d->settings->beginGroup(kGroupItems);
 
         int index = 0;
-        for (auto iter = base->items.begin(); iter != base->items.end();) {
+        for (auto iter = base->items().begin(); iter != base->items().end();) {
             d->settings->setValue(QString::number(index), iter->toString());
             ++index;
             ++iter;
@@ -272,7 +276,7 @@ void OrganizerConfig::writeCollectionBase(bool custom, const QList<CollectionBas
             d->settings->beginGroup(kGroupItems);
 
             int index = 0;
-            for (auto it = (*iter)->items.begin(); it != (*iter)->items.end();) {
+            for (auto it = (*iter)->items().begin(); it != (*iter)->items().end();) {
                 d->settings->setValue(QString::number(index), it->toString());
                 ++index;
                 ++it;
@@ -60,12 +60,17 @@ CollectionItemDelegatePrivate::~CollectionItemDelegatePrivate()
 {
 }
 
-ElideTextLayout *CollectionItemDelegatePrivate::createTextlayout(const QModelIndex &index, const QPainter *painter) const
+ElideTextLayout *CollectionItemDelegatePrivate::textLayout(const QModelIndex &index, const QPainter *painter) const
 {
     bool showSuffix = Application::instance()->genericAttribute(Application::kShowedFileSuffix).toBool();
     QString name = showSuffix ? index.data(Global::ItemRoles::kItemFileDisplayNameRole).toString()
                               : index.data(Global::ItemRoles::kItemFileBaseNameOfRenameRole).toString();
-    ElideTextLayout *layout = new ElideTextLayout(name);
+    if (layout.isNull()) {
+        layout.reset(new ElideTextLayout);
+        layout->setLayoutCache(&layoutCache);
+    }
+
+    layout->reset(name);
     layout->setAttribute(ElideTextLayout::kWrapMode, (uint)QTextOption::WrapAtWordBoundaryOrAnywhere);
     layout->setAttribute(ElideTextLayout::kLineHeight, textLineHeight);
     layout->setAttribute(ElideTextLayout::kAlignment, Qt::AlignHCenter);
@@ -74,7 +79,7 @@ ElideTextLayout *CollectionItemDelegatePrivate::createTextlayout(const QModelInd
         layout->setAttribute(ElideTextLayout::kTextDirection, painter->layoutDirection());
     }
 
-    return layout;
+    return layout.data();
 }
 
 bool CollectionItemDelegatePrivate::needExpend(const QStyleOptionViewItem &option, const QModelIndex &index, const QRect &rText, QRect *needText) const
@@ -393,9 +398,9 @@ Qt::Alignment CollectionItemDelegate::visualAlignment(Qt::LayoutDirection direct
 QList<QRectF> CollectionItemDelegate::elideTextRect(const QModelIndex &index, const QRect &rect, const Qt::TextElideMode &elideMode) const
 {
     // create text Layout.
-    QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index));
+    ElideTextLayout *layout = d->textLayout(index);
 
-    d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+    d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
     // elide mode
     auto textLines = layout->layout(rect, elideMode);
@@ -410,7 +415,7 @@ bool CollectionItemDelegate::isTransparent(const QModelIndex &index) const
         if (!file.get())
             return false;
 
-        if (ClipBoard::instance()->clipboardFileUrlList().contains(file->urlOf(UrlInfoType::kUrl)))
+        if (ClipBoard::instance()->isCut(file->urlOf(UrlInfoType::kUrl)))
             return true;
     }
     return false;
@@ -448,9 +453,9 @@ void CollectionItemDelegate::drawNormlText(QPainter *painter, const QStyleOption
         p.setFont(painter->font());
 
         // create text Layout.
-        QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, &p));
+        ElideTextLayout *layout = d->textLayout(index, &p);
 
-        d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+        d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
         // elide and draw
         layout->layout(QRectF(QPoint(0, 0), QSizeF(textImage.size()) / pixelRatio), option.textElideMode, &p);
@@ -490,10 +495,10 @@ void CollectionItemDelegate::drawHighlightText(QPainter *painter, const QStyleOp
         auto background = option.palette.brush(QPalette::Normal, QPalette::Highlight);
 
         // create text Layout.
-        QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, painter));
+        ElideTextLayout *layout = d->textLayout(index, painter);
         layout->setAttribute(ElideTextLayout::kBackgroundRadius, kIconRectRadius);
 
-        d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+        d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
         // elide and draw
         layout->layout(rText, option.textElideMode, painter, background);
@@ -508,10 +513,10 @@ void CollectionItemDelegate::drawExpandText(QPainter *painter, const QStyleOptio
     auto background = option.palette.brush(QPalette::Normal, QPalette::Highlight);
 
     // create text Layout.
-    QScopedPointer<ElideTextLayout> layout(d->createTextlayout(index, painter));
+    ElideTextLayout *layout = d->textLayout(index, painter);
     layout->setAttribute(ElideTextLayout::kBackgroundRadius, kIconRectRadius);
 
-    d->extendLayoutText(parent()->model()->fileInfo(index), layout.data());
+    d->extendLayoutText(parent()->model()->fileInfo(index), layout);
 
     // elide and draw
     layout->layout(rect, option.textElideMode, painter, background);
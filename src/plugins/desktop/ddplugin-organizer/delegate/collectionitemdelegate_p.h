@@ -8,6 +8,7 @@
 #include "collectionitemdelegate.h"
 
 #include <dfm-base/utils/elidetextlayout.h>
+#include <dfm-base/utils/elidetextlayoutcache.h>
 
 #include <QPointer>
 #include <QTextDocument>
@@ -21,7 +22,8 @@ public:
     explicit CollectionItemDelegatePrivate(CollectionItemDelegate *qq);
     ~CollectionItemDelegatePrivate();
 
-    dfmbase::ElideTextLayout *createTextlayout(const QModelIndex &index, const QPainter *painter = nullptr) const;
+    // the layout is reused by every paint, it is valid until the next call.
+    dfmbase::ElideTextLayout *textLayout(const QModelIndex &index, const QPainter *painter = nullptr) const;
 
     inline QRect availableTextRect(QRect labelRect) const {
         // available text rect top is label rect minus icon space and text padding.
@@ -41,6 +43,8 @@ public:
     // default icon size is 48px.
     int currentIconLevel = -1;
     int textLineHeight = -1;
+    mutable dfmbase::ElideTextLayoutCache layoutCache;
+    mutable QScopedPointer<dfmbase::ElideTextLayout> layout;
     static const QList<int> kIconSizes;
     //QList<int> charOfLine;
     QStringList iconLevelDescriptions;
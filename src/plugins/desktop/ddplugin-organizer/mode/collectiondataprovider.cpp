@@ -22,13 +22,7 @@ CollectionDataProvider::~CollectionDataProvider()
 QString CollectionDataProvider::key(const QUrl &url) const
 {
     QString ret;
-    auto it = std::find_if(collections.begin(), collections.end(), [&url](const CollectionBaseDataPtr &ptr) {
-        return ptr->items.contains(url);
-    });
-
-    if (it != collections.end())
-        ret = (*it)->key;
-
+    locate(url, &ret);
     return ret;
 }
 
@@ -50,18 +44,15 @@ QList<QUrl> CollectionDataProvider::items(const QString &key) const
 {
     QList<QUrl> ret;
     if (auto ptr = collections.value(key))
-        ret = ptr->items;
+        ret = ptr->urls;
 
     return ret;
 }
 
 bool CollectionDataProvider::contains(const QString &key, const QUrl &url) const
 {
-    auto it = collections.find(key);
-    if (it == collections.end())
-        return false;
-
-    return (*it)->items.contains(url);
+    QString cur;
+    return locate(url, &cur) && cur == key;
 }
 
 bool CollectionDataProvider::sorted(const QString &key, const QList<QUrl> &urls)
@@ -70,16 +61,17 @@ bool CollectionDataProvider::sorted(const QString &key, const QList<QUrl> &urls)
     if (it == collections.end())
         return false;
 
-    if ((*it)->items.size() != urls.size())
+    if ((*it)->urls.size() != urls.size())
         return false;
 
     // check data, \a all member of urls must be in items.
+    QString cur;
     for (const QUrl &url : urls) {
-        if (!(*it)->items.contains(url))
+        if (!locate(url, &cur) || cur != key)
             return false;
     }
 
-    (*it)->items = urls;
+    (*it)->urls = urls;
     emit itemsChanged(key);
     return true;
 }
@@ -99,19 +91,19 @@ void CollectionDataProvider::moveUrls(const QList<QUrl> &urls, const QString &ta
         // same collection
         auto it = collections.find(sourceId);
         if (it != collections.end()) {
+            QList<QUrl> &items = it.value()->urls;
             for (auto url : urls) {
-                int oldIndex = it.value()->items.indexOf(url);
-                if (-1 == oldIndex) {
-                    fmWarning() << "unknow error:" << url << it.value()->items;
+                int oldIndex = items.indexOf(url);
+                if (oldIndex < 0) {
+                    fmWarning() << "unknow error:" << url << items;
                     continue;
                 }
                 if (oldIndex < targetIndex)
                     targetIndex--;
-                it.value()->items.removeOne(url);
-            }
-            for (auto url : urls) {
-                it.value()->items.insert(targetIndex++, url);
+                items.removeAt(oldIndex);
             }
+            for (auto url : urls)
+                items.insert(targetIndex++, url);
             emit itemsChanged(sourceId);
         }
     } else {
@@ -119,7 +111,10 @@ void CollectionDataProvider::moveUrls(const QList<QUrl> &urls, const QString &ta
         auto it = collections.find(sourceId);
         if (it != collections.end()) {
             for (auto url : urls) {
-                it.value()->items.removeOne(url);
+                if (itemKeys.value(url) == sourceId) {
+                    it.value()->urls.removeOne(url);
+                    itemKeys.remove(url);
+                }
             }
             emit itemsChanged(sourceId);
         } else {
@@ -128,7 +123,8 @@ void CollectionDataProvider::moveUrls(const QList<QUrl> &urls, const QString &ta
         it = collections.find(targetKey);
         if (it != collections.end()) {
             for (auto url : urls) {
-                it.value()->items.insert(targetIndex++, url);
+                it.value()->urls.insert(targetIndex++, url);
+                itemKeys.insert(url, targetKey);
             }
             emit itemsChanged(targetKey);
         }
@@ -179,3 +175,125 @@ bool CollectionDataProvider::takePreItem(const QUrl &url, QString &key, int &ind
     return false;
 }
 
+
+void CollectionDataProvider::setItems(const QString &key, const QList<QUrl> &urls)
+{
+    auto ptr = collections.value(key);
+    if (!ptr)
+        return;
+
+    for (const QUrl &url : ptr->urls) {
+        auto it = itemKeys.find(url);
+        if (it != itemKeys.end() && it.value() == key)
+            itemKeys.erase(it);
+    }
+
+    ptr->urls = urls;
+    for (const QUrl &url : urls)
+        itemKeys.insert(url, key);
+}
+
+/*!
+ * \brief insert \a url at \a index of the collection \a key, append it if \a index is out of range.
+ */
+bool CollectionDataProvider::insertItem(const QString &key, const QUrl &url, int index)
+{
+    auto ptr = collections.value(key);
+    if (!ptr)
+        return false;
+
+    if (index < 0 || index > ptr->urls.size())
+        ptr->urls.append(url);
+    else
+        ptr->urls.insert(index, url);
+    itemKeys.insert(url, key);
+    return true;
+}
+
+bool CollectionDataProvider::removeItem(const QString &key, const QUrl &url)
+{
+    auto ptr = collections.value(key);
+    if (!ptr || !ptr->urls.removeOne(url))
+        return false;
+
+    auto it = itemKeys.find(url);
+    if (it != itemKeys.end() && it.value() == key)
+        itemKeys.erase(it);
+    return true;
+}
+
+bool CollectionDataProvider::replaceItem(const QString &key, const QUrl &oldUrl, const QUrl &newUrl)
+{
+    auto ptr = collections.value(key);
+    if (!ptr)
+        return false;
+
+    const int idx = ptr->urls.indexOf(oldUrl);
+    if (idx < 0)
+        return false;
+
+    ptr->urls.replace(idx, newUrl);
+    auto it = itemKeys.find(oldUrl);
+    if (it != itemKeys.end() && it.value() == key)
+        itemKeys.erase(it);
+    itemKeys.insert(newUrl, key);
+    return true;
+}
+
+bool CollectionDataProvider::locate(const QUrl &url, QString *key, int *index) const
+{
+    auto it = itemKeys.constFind(url);
+    if (it == itemKeys.constEnd())
+        return false;
+
+    if (index) {
+        auto ptr = collections.value(it.value());
+        *index = ptr ? ptr->urls.indexOf(url) : -1;
+        if (*index < 0)
+            return false;
+    }
+
+    if (key)
+        *key = it.value();
+    return true;
+}
+
+CollectionBaseDataPtr CollectionDataProvider::collection(const QString &key) const
+{
+    return collections.value(key);
+}
+
+QList<CollectionBaseDataPtr> CollectionDataProvider::allCollections() const
+{
+    return collections.values();
+}
+
+void CollectionDataProvider::addCollection(const CollectionBaseDataPtr &base)
+{
+    if (!base)
+        return;
+
+    removeCollection(base->key);
+    collections.insert(base->key, base);
+    for (const QUrl &url : base->urls)
+        itemKeys.insert(url, base->key);
+}
+
+void CollectionDataProvider::removeCollection(const QString &key)
+{
+    auto ptr = collections.take(key);
+    if (!ptr)
+        return;
+
+    for (const QUrl &url : ptr->urls) {
+        auto it = itemKeys.find(url);
+        if (it != itemKeys.end() && it.value() == key)
+            itemKeys.erase(it);
+    }
+}
+
+void CollectionDataProvider::clearCollections()
+{
+    collections.clear();
+    itemKeys.clear();
+}
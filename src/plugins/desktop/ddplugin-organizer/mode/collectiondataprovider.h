@@ -36,13 +36,30 @@ public:
     virtual void insert(const QUrl &, const QString &, const int) = 0;
     virtual QString remove(const QUrl &) = 0;
     virtual QString change(const QUrl &) = 0;
+    // change the items of a collection and keep the index in step.
+    void setItems(const QString &key, const QList<QUrl> &urls);
+    bool insertItem(const QString &key, const QUrl &url, int index = -1);
+    bool removeItem(const QString &key, const QUrl &url);
+    bool replaceItem(const QString &key, const QUrl &oldUrl, const QUrl &newUrl);
 signals:
     void nameChanged(const QString &key, const QString &name);
     void itemsChanged(const QString &key);
 
 protected:
-    QHash<QString, CollectionBaseDataPtr> collections;
+    bool locate(const QUrl &url, QString *key, int *index = nullptr) const;
+    CollectionBaseDataPtr collection(const QString &key) const;
+    QList<CollectionBaseDataPtr> allCollections() const;
+    void addCollection(const CollectionBaseDataPtr &base);
+    void removeCollection(const QString &key);
+    void clearCollections();
+
+protected:
     QHash<QString, QPair<int, QList<QUrl>>> preCollectionItems;
+
+private:
+    QHash<QString, CollectionBaseDataPtr> collections;
+    // url to the key of the collection holding it.
+    QHash<QUrl, QString> itemKeys;
 };
 
 }
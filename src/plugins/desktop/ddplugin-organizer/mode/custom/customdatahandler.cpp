@@ -22,54 +22,54 @@ CustomDataHandler::~CustomDataHandler()
 
 void CustomDataHandler::check(const QSet<QUrl> &vaild)
 {
-    for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-        for (auto it = iter.value()->items.begin(); it != iter.value()->items.end();) {
-            if (vaild.contains(*it)) {
-                ++it;
-            } else {
-                it = iter.value()->items.erase(it);
-            }
+    for (const CollectionBaseDataPtr &base : allCollections()) {
+        QList<QUrl> kept;
+        kept.reserve(base->items().size());
+        for (const QUrl &url : base->items()) {
+            if (vaild.contains(url))
+                kept.append(url);
         }
+
+        if (kept.size() != base->items().size())
+            setItems(base->key, kept);
     }
 }
 
 QList<CollectionBaseDataPtr> CustomDataHandler::baseDatas() const
 {
-    return collections.values();
+    return allCollections();
 }
 
 bool CustomDataHandler::addBaseData(const CollectionBaseDataPtr &base)
 {
-    if (!base || collections.contains(base->key))
+    if (!base || collection(base->key))
         return false;
 
-    collections.insert(base->key, base);
+    addCollection(base);
     return true;
 }
 
 void CustomDataHandler::removeBaseData(const QString &key)
 {
-    collections.remove(key);
+    removeCollection(key);
 }
 
 bool CustomDataHandler::reset(const QList<CollectionBaseDataPtr> &datas)
 {
     for (const CollectionBaseDataPtr &ptr : datas)
-        collections.insert(ptr->key, ptr);
+        addCollection(ptr);
 
     return true;
 }
 
 QString CustomDataHandler::remove(const QUrl &url)
 {
-    for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-        if (iter.value()->items.removeOne(url)) {
-            emit itemsChanged(iter.key());
-            return iter.key();
-        }
-    }
+    QString key;
+    if (!locate(url, &key) || !removeItem(key, url))
+        return "";
 
-    return "";
+    emit itemsChanged(key);
+    return key;
 }
 
 QString CustomDataHandler::change(const QUrl &)
@@ -79,40 +79,22 @@ QString CustomDataHandler::change(const QUrl &)
 
 QString CustomDataHandler::replace(const QUrl &oldUrl, const QUrl &newUrl)
 {
-    CollectionBaseDataPtr old;
-    int oldIdx = -1;
-    int newIdx = -1;
-    for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-        if (oldIdx < 0) {
-            oldIdx = iter.value()->items.indexOf(oldUrl);
-            if (oldIdx >= 0) {
-                // find old
-                old = iter.value();
-            }
-        }
-
-        if (newIdx < 0)
-            newIdx = iter.value()->items.indexOf(newUrl);
-
-        if (oldIdx >= 0 && newIdx >= 0)
-            break;
-    }
-
-    if (oldIdx < 0) {
+    QString oldKey;
+    if (!locate(oldUrl, &oldKey)) {
         fmWarning() << "replace: no old url:" << oldUrl;
         return "";
     }
 
-    if (newIdx >= 0) {
+    if (locate(newUrl, nullptr)) {
         fmWarning() << "replace: new url is existed:" << newUrl;
         return "";
     }
 
-    Q_ASSERT(old);
-    old->items.replace(oldIdx, newUrl);
-    emit itemsChanged(old->key);
+    if (!replaceItem(oldKey, oldUrl, newUrl))
+        return "";
+    emit itemsChanged(oldKey);
 
-    return old->key;
+    return oldKey;
 }
 
 QString CustomDataHandler::append(const QUrl &)
@@ -127,13 +109,9 @@ QString CustomDataHandler::prepend(const QUrl &)
 
 void CustomDataHandler::insert(const QUrl &url, const QString &key, const int index)
 {
-    auto it = collections.find(key);
-    if (Q_UNLIKELY(it == collections.end())) {
-        CollectionBaseDataPtr base(new CollectionBaseData);
+    if (Q_UNLIKELY(!insertItem(key, url, index))) {
+        CollectionBaseDataPtr base(new CollectionBaseData(QList<QUrl> { url }));
         base->key = key;
-        base->items << url;
-    } else {
-        it.value()->items.insert(index, url);
     }
 
     emit itemsChanged(key);
@@ -144,24 +122,15 @@ bool CustomDataHandler::acceptInsert(const QUrl &url)
     // todo(wcl) 新建流程
 
 
-    for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-        if (iter.value()->items.contains(url)) {
-           return true;
-        }
-    }
-
-    return false;
+    return locate(url, nullptr);
 }
 
 QList<QUrl> CustomDataHandler::acceptReset(const QList<QUrl> &urls)
 {
     QList<QUrl> ret;
     for (const QUrl &url : urls) {
-        for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-            if (iter.value()->items.contains(url)) {
-                ret << url;
-            }
-        }
+        if (locate(url, nullptr))
+            ret << url;
     }
 
     return ret;
@@ -169,11 +138,5 @@ QList<QUrl> CustomDataHandler::acceptReset(const QList<QUrl> &urls)
 
 bool CustomDataHandler::acceptRename(const QUrl &oldUrl, const QUrl &newUrl)
 {
-    for (auto iter = collections.begin(); iter != collections.end(); ++iter) {
-        if (iter.value()->items.contains(oldUrl)
-                || iter.value()->items.contains(newUrl))
-            return true;
-    }
-
-    return false;
+    return locate(oldUrl, nullptr) || locate(newUrl, nullptr);
 }
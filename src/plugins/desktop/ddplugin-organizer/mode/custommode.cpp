@@ -342,10 +342,9 @@ void CustomMode::onNewCollection(const QList<QUrl> &list)
         return;
 
     // todo 检查数据有效性
-    CollectionBaseDataPtr base(new CollectionBaseData);
+    CollectionBaseDataPtr base(new CollectionBaseData(list));
     base->name = tr("New Collection");
     base->key = QUuid::createUuid().toString(QUuid::WithoutBraces);
-    base->items = list;
 
     d->dataHandler->addBaseData(base);
 
@@ -379,7 +378,7 @@ void CustomMode::onDeleteCollection(const QString &key)
             return handler->key == key;
         });
         if (it != bd.end())
-            urls = (*it)->items;
+            urls = (*it)->items();
     }
 
     d->dataHandler->removeBaseData(key);
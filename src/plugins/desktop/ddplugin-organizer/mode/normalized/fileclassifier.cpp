@@ -34,15 +34,7 @@ FileClassifier::FileClassifier(QObject *parent)
 
 void FileClassifier::reset(const QList<QUrl> &urls)
 {
-    collections.clear();
-    for (const QString &id : classes()) {
-        CollectionBaseDataPtr dp(new CollectionBaseData);
-        dp->name = className(id);
-        dp->key = id;
-
-        collections.insert(id, dp);
-    }
-
+    QHash<QString, QList<QUrl>> classified;
     for (const QUrl &url : urls) {
         auto type = classify(url);
         if (type.isEmpty()) {
@@ -50,22 +42,28 @@ void FileClassifier::reset(const QList<QUrl> &urls)
             continue;
         }
 
-        auto it = collections.find(type);
-        if (it != collections.end())
-            it.value()->items.append(url);
-        else
-            Q_ASSERT_X(it == collections.end(), "TypeClassifier", QString("unrecognized type %0").arg(type).toStdString().c_str());
+        // the unrecognized types are dropped with the collections.
+        classified[type].append(url);
+    }
+
+    clearCollections();
+    for (const QString &id : classes()) {
+        CollectionBaseDataPtr dp(new CollectionBaseData(classified.value(id)));
+        dp->name = className(id);
+        dp->key = id;
+
+        addCollection(dp);
     }
 }
 
 QList<CollectionBaseDataPtr> FileClassifier::baseData() const
 {
-    return collections.values();
+    return allCollections();
 }
 
 CollectionBaseDataPtr FileClassifier::baseData(const QString &key) const
 {
-    return collections.value(key);
+    return collection(key);
 }
 
 QString FileClassifier::replace(const QUrl &oldUrl, const QUrl &newUrl)
@@ -82,19 +80,18 @@ QString FileClassifier::replace(const QUrl &oldUrl, const QUrl &newUrl)
 
     if (Q_UNLIKELY(newType.isEmpty())) {
         fmWarning() << "can not find file:" << newUrl;
-        collections[oldType]->items.removeOne(oldUrl);
+        removeItem(oldType, oldUrl);
         return newType;
     }
 
     if (oldType == newType) {
-        int idx = collections[newType]->items.indexOf(oldUrl);
-        collections[newType]->items.replace(idx, newUrl);
+        replaceItem(newType, oldUrl, newUrl);
         emit itemsChanged(newType);
     } else {
-        collections[oldType]->items.removeOne(oldUrl);
+        removeItem(oldType, oldUrl);
         emit itemsChanged(oldType);
 
-        collections[newType]->items.append(newUrl);
+        insertItem(newType, newUrl);
         emit itemsChanged(newType);
     }
 #else
@@ -154,19 +151,14 @@ QString FileClassifier::append(const QUrl &url)
 
     // do not exist
     if (cur.isEmpty()) {
-        auto it = collections.find(ret);
-        if (it != collections.end()) {
-            it.value()->items.append(url);
+        if (insertItem(ret, url))
             emit itemsChanged(ret);
-        } else {
-            Q_ASSERT_X(it == collections.end(), "TypeClassifier", QString("unrecognized type %0").arg(ret).toStdString().c_str());
-        }
     } else {   // existed
         if (cur != ret) {
-            collections[cur]->items.removeOne(url);
+            removeItem(cur, url);
             emit itemsChanged(cur);
 
-            collections[ret]->items.append(url);
+            insertItem(ret, url);
             emit itemsChanged(ret);
         }
     }
@@ -186,19 +178,14 @@ QString FileClassifier::prepend(const QUrl &url)
 
     // do not exist
     if (cur.isEmpty()) {
-        auto it = collections.find(ret);
-        if (it != collections.end()) {
-            it.value()->items.prepend(url);
+        if (insertItem(ret, url, 0))
             emit itemsChanged(ret);
-        } else {
-            Q_ASSERT_X(it == collections.end(), "TypeClassifier", QString("unrecognized type %0").arg(ret).toStdString().c_str());
-        }
     } else {   // existed
         if (cur != ret) {
-            collections[cur]->items.removeOne(url);
+            removeItem(cur, url);
             emit itemsChanged(cur);
 
-            collections[ret]->items.prepend(url);
+            insertItem(ret, url, 0);
             emit itemsChanged(ret);
         }
     }
@@ -214,14 +201,8 @@ void FileClassifier::insert(const QUrl &, const QString &, const int)
 QString FileClassifier::remove(const QUrl &url)
 {
     QString ret;
-    for (auto itor = collections.begin(); itor != collections.end(); ++itor) {
-        if (itor.value()->items.contains(url)) {
-            itor.value()->items.removeOne(url);
-            ret = itor.key();
-            emit itemsChanged(ret);
-            break;
-        }
-    }
+    if (locate(url, &ret) && removeItem(ret, url))
+        emit itemsChanged(ret);
 
     return ret;
 }
@@ -234,10 +215,10 @@ QString FileClassifier::change(const QUrl &url)
 
     QString ret = classify(url);
     if (ret != cur) {
-        collections[cur]->items.removeOne(url);
+        removeItem(cur, url);
         emit itemsChanged(cur);
 
-        collections[ret]->items.append(url);
+        insertItem(ret, url);
         emit itemsChanged(ret);
 
         return ret;
@@ -47,6 +47,7 @@ public slots:
 
 public:
     void restore(const QList<CollectionBaseDataPtr> &cfgs, bool reorganized = false);
+    int applyFileChanges(const QList<QUrl> &files);
     FileClassifier *classifier = nullptr;
     QHash<QString, CollectionHolderPointer> holders;
     NormalizedModeBroker *broker = nullptr;
@@ -9,6 +9,12 @@
 #include <dfm-base/file/local/syncfileinfo.h>
 #include <dfm-base/base/schemefactory.h>
 
+#include <QFile>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+
 using namespace ddplugin_organizer;
 DFMBASE_USE_NAMESPACE
 
@@ -31,27 +37,98 @@ inline const char kTypeSuffixApp[] = "desktop";
 //inline const char kTypeMimeApp[] = "application/x-shellscript,application/x-desktop,application/x-executable";
 }
 
-#define InitSuffixTable(table, suffix)                                 \
-    {                                                                  \
-        QSet<QString> *tablePtr = const_cast<QSet<QString> *>(&table); \
-        *tablePtr = tablePtr->fromList(QString(suffix).split(','));    \
-    }
 TypeClassifierPrivate::TypeClassifierPrivate(TypeClassifier *qq)
     : q(qq)
 {
     //todo(zy) 类型后缀支持可配置
-    InitSuffixTable(docSuffix, kTypeSuffixDoc);
-    InitSuffixTable(picSuffix, kTypeSuffixPic);
-    InitSuffixTable(muzSuffix, kTypeSuffixMuz);
-    InitSuffixTable(vidSuffix, kTypeSuffixVid);
-    InitSuffixTable(appSuffix, kTypeSuffixApp);
-    //InitSuffixTable(appMimeType, kTypeMimeApp);
+    // a suffix in more than one list belongs to the first one.
+    const QList<QPair<const char *, const char *>> lists {
+        { kTypeSuffixDoc, kTypeKeyDoc },
+        { kTypeSuffixApp, kTypeKeyApp },
+        { kTypeSuffixVid, kTypeKeyVid },
+        { kTypeSuffixPic, kTypeKeyPic },
+        { kTypeSuffixMuz, kTypeKeyMuz }
+    };
+
+    QMap<QByteArray, const char *> types;
+    for (const auto &list : lists) {
+        for (const QByteArray &suffix : QByteArray(list.first).toLower().split(',')) {
+            if (!types.contains(suffix))
+                types.insert(suffix, list.second);
+        }
+    }
+
+    QVector<SuffixType> *tablePtr = const_cast<QVector<SuffixType> *>(&suffixTypes);
+    tablePtr->reserve(types.size());
+    for (auto it = types.cbegin(); it != types.cend(); ++it) {
+        tablePtr->append({ it.key(), it.value() });
+        maxSuffixLength = qMax(maxSuffixLength, it.key().size());
+    }
 }
 
 TypeClassifierPrivate::~TypeClassifierPrivate()
 {
 }
 
+/*!
+ * \brief the type of file name by its suffix, see FileInfo::nameOf(kSuffix).
+ * the trailing dots are skipped as FileInfo does, so "a.pdf." is a document.
+ * the suffix is case folded on stack and searched in the sorted table.
+ * \return nullptr if the suffix is unknown.
+ */
+const char *TypeClassifierPrivate::suffixType(const QString &fileName) const
+{
+    int end = fileName.size();
+    while (end > 0 && fileName.at(end - 1) == '.')
+        --end;
+    if (end == 0)
+        return nullptr;
+
+    const int dot = fileName.lastIndexOf('.', end - 1);
+    // no suffix for hidden files without dot.
+    if (dot <= 0)
+        return nullptr;
+
+    const int length = end - dot - 1;
+    if (length > maxSuffixLength)
+        return nullptr;
+
+    char folded[32];
+    Q_ASSERT(maxSuffixLength < static_cast<int>(sizeof(folded)));
+    for (int i = 0; i < length; ++i) {
+        const ushort ch = fileName.at(dot + 1 + i).unicode();
+        if (ch >= 0x80)   // all known suffixes are ascii.
+            return nullptr;
+        folded[i] = static_cast<char>(ch >= 'A' && ch <= 'Z' ? ch + ('a' - 'A') : ch);
+    }
+
+    const QByteArray &key = QByteArray::fromRawData(folded, length);
+    auto it = std::lower_bound(suffixTypes.cbegin(), suffixTypes.cend(), key,
+                               [](const SuffixType &item, const QByteArray &suffix) {
+                                   return item.suffix < suffix;
+                               });
+    if (it != suffixTypes.cend() && it->suffix == key)
+        return it->type;
+    return nullptr;
+}
+
+/*!
+ * \brief the type of the local target of a symlink, it only needs one lstat
+ * instead of creating a file info for the target.
+ */
+const char *TypeClassifierPrivate::localTargetType(const QString &path) const
+{
+    struct stat st;
+    if (::lstat(QFile::encodeName(path).constData(), &st) == 0) {
+        if (S_ISLNK(st.st_mode))
+            return kTypeKeyOth;
+        if (S_ISDIR(st.st_mode))
+            return kTypeKeyFld;
+    }
+
+    return suffixType(path.mid(path.lastIndexOf('/') + 1));
+}
+
 TypeClassifier::TypeClassifier(QObject *parent)
     : FileClassifier(parent), d(new TypeClassifierPrivate(this))
 {
@@ -144,39 +221,32 @@ QString TypeClassifier::classify(const QUrl &url) const
     if (!itemInfo)
         return QString();   // must return null string to represent the file is not existed.
 
-    QString key;
+    const char *key = nullptr;
     //Classify whether it is a symlink according to the symlink's target
     if (itemInfo->isAttributes(OptInfoType::kIsSymLink)) {
         QUrl fileUrl = itemInfo->urlOf(UrlInfoType::kRedirectedFileUrl);
-        itemInfo = InfoFactory::create<FileInfo>(fileUrl);
-        if (itemInfo->isAttributes(OptInfoType::kIsSymLink)) {
-            key = kTypeKeyOth;
-            return key;
+        if (fileUrl.isLocalFile()) {
+            key = d->localTargetType(fileUrl.toLocalFile());
+            return QString(key ? key : kTypeKeyOth);
         }
+
+        itemInfo = InfoFactory::create<FileInfo>(fileUrl);
+        if (!itemInfo || itemInfo->isAttributes(OptInfoType::kIsSymLink))
+            return kTypeKeyOth;
     }
 
     if (itemInfo->isAttributes(OptInfoType::kIsDir)) {
         key = kTypeKeyFld;
     } else {
         // classified by suffix.
-        const QString &suffix = itemInfo->nameOf(NameInfoType::kSuffix).toLower();
-        if (d->docSuffix.contains(suffix))
-            key = kTypeKeyDoc;
-        else if (d->appSuffix.contains(suffix))
-            key = kTypeKeyApp;
-        else if (d->vidSuffix.contains(suffix))
-            key = kTypeKeyVid;
-        else if (d->picSuffix.contains(suffix))
-            key = kTypeKeyPic;
-        else if (d->muzSuffix.contains(suffix))
-            key = kTypeKeyMuz;
+        key = d->suffixType(itemInfo->nameOf(NameInfoType::kFileName));
     }
 
     // set it to other if it not belong to any category
     // if its category is disabled. use: `d->categories.testFlag(d->categoryKey.key(key)`
-    if (key.isEmpty())
+    if (!key)
         key = kTypeKeyOth;
-    return key;
+    return QString(key);
 }
 
 QString TypeClassifier::className(const QString &key) const
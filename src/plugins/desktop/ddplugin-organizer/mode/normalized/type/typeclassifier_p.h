@@ -7,22 +7,30 @@
 
 #include "typeclassifier.h"
 
+#include <QVector>
+
 namespace ddplugin_organizer {
 
+struct SuffixType
+{
+    QByteArray suffix;   // lower case
+    const char *type = nullptr;
+};
+
 class TypeClassifierPrivate
 {
 public:
     explicit TypeClassifierPrivate(TypeClassifier *qq);
     ~TypeClassifierPrivate();
+    const char *suffixType(const QString &fileName) const;
+    const char *localTargetType(const QString &path) const;
 public:
     ItemCategories categories;
     const QHash<ItemCategory, QString> categoryKey;
     const QHash<QString, QString> keyNames;
-    const QSet<QString> docSuffix;
-    const QSet<QString> picSuffix;
-    const QSet<QString> muzSuffix;
-    const QSet<QString> vidSuffix;
-    const QSet<QString> appSuffix;
+    // the type of every known suffix, sorted by suffix.
+    const QVector<SuffixType> suffixTypes;
+    int maxSuffixLength = 0;
     //const QSet<QString> appMimeType;
 private:
     TypeClassifier *q;
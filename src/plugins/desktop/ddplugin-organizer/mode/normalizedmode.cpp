@@ -11,6 +11,7 @@
 #include "interface/canvasmodelshell.h"
 #include "utils/fileoperator.h"
 #include "utils/renamedialog.h"
+#include "utils/freerectpacker.h"
 #include "view/collectionview.h"
 #include "view/collectionframe.h"
 #include "delegate/collectionitemdelegate.h"
@@ -20,7 +21,7 @@
 #include <dfm-framework/dpf.h>
 
 #include <QDebug>
-#include <QTime>
+#include <QElapsedTimer>
 
 using namespace ddplugin_organizer;
 
@@ -48,21 +49,14 @@ QPoint NormalizedModePrivate::findValidPos(int &currentIndex, const int width, c
 
     auto gridSize = sur->gridSize();
 
-    QPoint pos(-1, -1);
-    // from UP to DOWN, RIGHT to LEFT, search an area to place the collection
-    for (int x = gridSize.width() - width; x >= 0; --x) {
-        for (int y = 0; y < gridSize.height() - height; ++y) {
-            QRect gridR { x, y, width, height };
-            auto screenR = sur->mapToPixelSize(gridR);
-            if (sur->isIntersected(screenR, nullptr))
-                continue;
-            pos = { x, y };
-            x = -1;   // break outside loop.
-            break;
-        }
-    }
+    // from UP to DOWN, RIGHT to LEFT, search an area to place the collection.
+    // the last row is not used.
+    FreeRectPacker packer({ gridSize.width(), gridSize.height() - 1 });
+    for (const QRect &used : sur->occupiedGridRects(nullptr))
+        packer.occupy(used);
 
-    if (pos.x() >= 0 && pos.y() >= 0)
+    QPoint pos;
+    if (packer.find({ width, height }, &pos))
         return pos;
     if (currentIndex == q->surfaces.count())
         return { 0, gridSize.height() - height };
@@ -116,13 +110,13 @@ void NormalizedModePrivate::switchCollection()
     bool changed = false;
     for (const CollectionBaseDataPtr &base : classifier->baseData()) {
         if (holders.contains(base->key)) {
-            if (base->items.isEmpty()) {
+            if (base->items().isEmpty()) {
                 fmDebug() << "Collection " << base->key << "is empty, remove it.";
                 holders.remove(base->key);
                 changed = true;
             }
         } else {
-            if (!base->items.isEmpty()) {
+            if (!base->items().isEmpty()) {
                 // create new collection.
                 fmDebug() << "Collection " << base->key << "isn't existed, create it.";
                 CollectionHolderPointer collectionHolder(createCollection(base->key));
@@ -191,22 +185,16 @@ void NormalizedModePrivate::connectCollectionSignals(CollectionHolderPointer col
 
 bool NormalizedModePrivate::tryPlaceRect(QRect &item, const QList<QRect> &inSeats, const QSize &table)
 {
-    auto isIntersects = [](const QRect &item, const QList<QRect> &items) -> bool {
-        for (auto rect : items) {
-            if (rect.intersects(item))
-                return true;
-        }
+    FreeRectPacker packer(table);
+    for (const QRect &seat : inSeats)
+        packer.occupy(seat);
+
+    QPoint pos;
+    if (!packer.find(item.size(), &pos))
         return false;
-    };
 
-    for (int x = table.width() - item.width(); x >= 0; --x) {
-        for (int y = 0; y <= table.height() - item.height(); ++y) {
-            item.moveTopLeft({ x, y });
-            if (!isIntersects(item, inSeats))
-                return true;
-        }
-    }
-    return false;
+    item.moveTopLeft(pos);
+    return true;
 }
 
 void NormalizedModePrivate::onSelectFile(QList<QUrl> &urls, int flag)
@@ -379,22 +367,104 @@ void NormalizedModePrivate::restore(const QList<CollectionBaseDataPtr> &cfgs, bo
     // order by config
     for (const CollectionBaseDataPtr &cfg : cfgs) {
         if (auto base = classifier->baseData(cfg->key)) {
-            QList<QUrl> org = base->items;
+            const QList<QUrl> org = base->items();
+            QSet<QUrl> remaining = org.toSet();
             QList<QUrl> ordered;
-            for (const QUrl &old : cfg->items) {
-                if (org.contains(old)) {
+            ordered.reserve(org.size());
+            for (const QUrl &old : cfg->items()) {
+                if (remaining.remove(old))
                     ordered << old;
-                    org.removeOne(old);
-                }
             }
 
             // those are not in config files should not be organized.
-            if (reorganized || !CfgPresenter->organizeOnTriggered())
-                ordered.append(org);
+            if (reorganized || !CfgPresenter->organizeOnTriggered()) {
+                for (const QUrl &url : org) {
+                    if (remaining.contains(url))
+                        ordered << url;
+                }
+            }
+
+            classifier->setItems(base->key, ordered);
+        }
+    }
+}
+
+/*!
+ * \brief apply the difference between \a files and the classified items.
+ * the items that still exist keep their positions, only the collections
+ * whose items are changed get notified.
+ * \return the count of changed items.
+ */
+int NormalizedModePrivate::applyFileChanges(const QList<QUrl> &files)
+{
+    const QSet<QUrl> current = files.toSet();
+    QSet<QUrl> classified;
+    QHash<QString, QList<QUrl>> moved;
+    QSet<QString> changedKeys;
+    int changes = 0;
+    // files put into or taken out of collections must be refiltered on canvas.
+    bool canvasChanged = false;
+
+    // remove the files that no longer exist and take out the files whose type changed.
+    for (const CollectionBaseDataPtr &base : classifier->baseData()) {
+        QList<QUrl> kept;
+        kept.reserve(base->items().size());
+        for (const QUrl &url : base->items()) {
+            classified.insert(url);
+            if (!current.contains(url)) {
+                ++changes;
+                continue;
+            }
+
+            const QString &type = classifier->classify(url);
+            if (type == base->key) {
+                kept.append(url);
+            } else {
+                ++changes;
+                canvasChanged = true;
+                if (!type.isEmpty() && classifier->baseData(type))
+                    moved[type].append(url);
+            }
+        }
+
+        if (kept.size() != base->items().size()) {
+            classifier->setItems(base->key, kept);
+            changedKeys.insert(base->key);
+        }
+    }
 
-            base->items = ordered;
+    // those are not in collections should not be organized.
+    const bool organizeNew = !CfgPresenter->organizeOnTriggered();
+    for (const QUrl &url : files) {
+        if (!organizeNew || classified.contains(url))
+            continue;
+
+        const QString &type = classifier->classify(url);
+        if (type.isEmpty() || !classifier->baseData(type)) {
+            fmWarning() << "can not classify file:" << url;
+            continue;
         }
+
+        ++changes;
+        moved[type].append(url);
+    }
+
+    for (auto it = moved.cbegin(); it != moved.cend(); ++it) {
+        for (const QUrl &url : it.value())
+            classifier->insertItem(it.key(), url);
+        changedKeys.insert(it.key());
+        canvasChanged = true;
     }
+
+    for (const QString &key : changedKeys)
+        Q_EMIT classifier->itemsChanged(key);
+
+    switchCollection();
+
+    // the canvas is reset before this, let it filter out the files now in collections.
+    if (canvasChanged)
+        Q_EMIT q->collectionChanged();
+    return changes;
 }
 
 NormalizedMode::NormalizedMode(QObject *parent)
@@ -448,7 +518,7 @@ bool NormalizedMode::initialize(CollectionModel *m)
     connect(model, &CollectionModel::dataReplaced, this, &NormalizedMode::onFileRenamed, Qt::DirectConnection);
 
     connect(model, &CollectionModel::dataChanged, this, &NormalizedMode::onFileDataChanged, Qt::QueuedConnection);
-    connect(model, &CollectionModel::modelReset, this, [this] { rebuild(); }, Qt::QueuedConnection);
+    connect(model, &CollectionModel::modelReset, this, &NormalizedMode::onModelReset, Qt::QueuedConnection);
 
     connect(CfgPresenter, &ConfigPresenter::reorganizeDesktop, this, &NormalizedMode::onReorganizeDesktop, Qt::QueuedConnection);
 
@@ -629,7 +699,7 @@ void NormalizedMode::detachLayout()
 void NormalizedMode::rebuild(bool reorganize)
 {
     // 使用分类器对文件进行分类，后续性能问题需考虑异步分类
-    QTime time;
+    QElapsedTimer time;
     time.start();
     {
         auto files = model->files();
@@ -678,6 +748,22 @@ void NormalizedMode::rebuild(bool reorganize)
     emit collectionChanged();
 }
 
+void NormalizedMode::onModelReset()
+{
+    // the classifier is not built, such as the classifier is just switched.
+    if (d->classifier->baseData().isEmpty()) {
+        rebuild();
+        return;
+    }
+
+    QElapsedTimer time;
+    time.start();
+
+    const QList<QUrl> &files = model->files();
+    int changes = d->applyFileChanges(files);
+    fmInfo() << QString("Updating %0 changes of %1 files takes %2 ms").arg(changes).arg(files.size()).arg(time.elapsed());
+}
+
 void NormalizedMode::onFileRenamed(const QUrl &oldUrl, const QUrl &newUrl)
 {
     if (CfgPresenter->organizeOnTriggered()) {
@@ -686,10 +772,9 @@ void NormalizedMode::onFileRenamed(const QUrl &oldUrl, const QUrl &newUrl)
             return;
         QString newType = d->classifier->classify(newUrl);
         if (newType == oldType) {
-            auto idx = d->classifier->baseData(oldType)->items.indexOf(oldUrl);
-            d->classifier->baseData(oldType)->items.replace(idx, newUrl);
+            d->classifier->replaceItem(oldType, oldUrl, newUrl);
         } else {
-            d->classifier->baseData(oldType)->items.removeAll(oldUrl);
+            d->classifier->removeItem(oldType, oldUrl);
             dpfSlotChannel->push("ddplugin_canvas", "slot_CanvasView_Select", QList<QUrl> { newUrl });
         }
 
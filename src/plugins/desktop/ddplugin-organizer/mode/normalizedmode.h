@@ -28,6 +28,7 @@ public:
 
 public slots:
     void rebuild(bool reorganize = false);
+    void onModelReset();
     void onFileRenamed(const QUrl &oldUrl, const QUrl &newUrl);
     void onFileInserted(const QModelIndex &parent, int first, int last);
     void onFileAboutToBeRemoved(const QModelIndex &parent, int first, int last);
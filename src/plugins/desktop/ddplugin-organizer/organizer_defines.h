@@ -61,10 +61,18 @@ enum CollectionFrameSize {
 
 class CollectionBaseData
 {
+    friend class CollectionDataProvider;
 public:
+    CollectionBaseData() = default;
+    explicit CollectionBaseData(const QList<QUrl> &items)
+        : urls(items) {}
+    inline const QList<QUrl> &items() const { return urls; }
+
     QString name;
     QString key;
-    QList<QUrl> items;
+private:
+    // changed by the provider holding it only, which indexes them.
+    QList<QUrl> urls;
 };
 
 typedef QSharedPointer<CollectionBaseData> CollectionBaseDataPtr;
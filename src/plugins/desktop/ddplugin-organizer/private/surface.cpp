@@ -180,6 +180,32 @@ bool Surface::isIntersected(const QRect &screenRect, QWidget *wid)
     return false;
 }
 
+QList<QRect> Surface::occupiedGridRects(QWidget *wid)
+{
+    // floor division, widgets may be partly outside of the grid.
+    auto toCell = [](int pixel) {
+        return pixel >= 0 ? pixel / cellWidth() : -((-pixel + cellWidth() - 1) / cellWidth());
+    };
+
+    const QPoint offset = gridOffset();
+    QList<QRect> rects;
+    auto children = this->children();
+    for (auto child : children) {
+        auto *frame = dynamic_cast<QWidget *>(child);
+        if (!frame || wid == frame || frame->property("ignore_collision").toBool())
+            continue;
+
+        // the cells a grid rect would have to avoid to not intersect with the frame.
+        const QRect geo = frame->geometry();
+        if (geo.isEmpty())
+            continue;
+        rects.append(QRect(QPoint(toCell(geo.left() - offset.x()), toCell(geo.top() - offset.y())),
+                           QPoint(toCell(geo.right() - offset.x()), toCell(geo.bottom() - offset.y()))));
+    }
+
+    return rects;
+}
+
 QRect Surface::findValidAreaAroundRect(const QRect &centerRect, QWidget *wid)
 {
     Q_ASSERT(wid);
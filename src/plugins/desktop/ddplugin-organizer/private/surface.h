@@ -68,6 +68,7 @@ public:
     static int pointsDistance(const QPoint &p1, const QPoint &p2);
     QList<QRect> intersectedRects(QWidget *wid);
     bool isIntersected(const QRect &screenRect, QWidget *wid);
+    QList<QRect> occupiedGridRects(QWidget *wid);
     QRect findValidAreaAroundRect(const QRect &centerRect, QWidget *wid);
     QRect findValidArea(QWidget *wid);
 signals:
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "freerectpacker.h"
+
+using namespace ddplugin_organizer;
+
+FreeRectPacker::FreeRectPacker(const QSize &table)
+    : bounds(QPoint(0, 0), table)
+{
+    if (bounds.isValid())
+        rects.append(bounds);
+}
+
+void FreeRectPacker::occupy(const QRect &rect)
+{
+    const QRect used = rect & bounds;
+    if (used.isEmpty())
+        return;
+
+    QList<QRect> splited;
+    splited.reserve(rects.size() + 4);
+    for (const QRect &free : rects) {
+        if (!free.intersects(used)) {
+            splited.append(free);
+            continue;
+        }
+
+        // each side of the used area that is left in the free one is a new maximal candidate.
+        if (free.left() < used.left())
+            splited.append(QRect(free.left(), free.top(), used.left() - free.left(), free.height()));
+        if (used.right() < free.right())
+            splited.append(QRect(used.right() + 1, free.top(), free.right() - used.right(), free.height()));
+        if (free.top() < used.top())
+            splited.append(QRect(free.left(), free.top(), free.width(), used.top() - free.top()));
+        if (used.bottom() < free.bottom())
+            splited.append(QRect(free.left(), used.bottom() + 1, free.width(), free.bottom() - used.bottom()));
+    }
+
+    prune(splited);
+    rects = splited;
+}
+
+bool FreeRectPacker::find(const QSize &size, QPoint *pos) const
+{
+    if (size.isEmpty())
+        return false;
+
+    // any free position lies in a maximal free rectangle, so the rightmost x is
+    // the largest one the rectangles offer, and the topmost y is taken among those reaching it.
+    QPoint best(-1, -1);
+    for (const QRect &free : rects) {
+        if (free.width() < size.width() || free.height() < size.height())
+            continue;
+
+        const int x = free.right() + 1 - size.width();
+        if (x > best.x() || (x == best.x() && free.top() < best.y()))
+            best = QPoint(x, free.top());
+    }
+
+    if (best.x() < 0)
+        return false;
+
+    if (pos)
+        *pos = best;
+    return true;
+}
+
+void FreeRectPacker::prune(QList<QRect> &rects)
+{
+    for (int i = 0; i < rects.size(); ++i) {
+        for (int j = i + 1; j < rects.size();) {
+            if (rects.at(i).contains(rects.at(j))) {
+                rects.removeAt(j);
+            } else if (rects.at(j).contains(rects.at(i))) {
+                rects.removeAt(i);
+                j = i + 1;
+            } else {
+                ++j;
+            }
+        }
+    }
+}
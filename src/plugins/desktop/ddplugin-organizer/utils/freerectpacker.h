@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FREERECTPACKER_H
+#define FREERECTPACKER_H
+
+#include "ddplugin_organizer_global.h"
+
+#include <QRect>
+#include <QList>
+
+namespace ddplugin_organizer {
+
+// keeps the maximal free rectangles of a grid table.
+class FreeRectPacker
+{
+public:
+    explicit FreeRectPacker(const QSize &table);
+    void occupy(const QRect &rect);
+    // the rightmost position, and the topmost one of them, that can hold size.
+    bool find(const QSize &size, QPoint *pos) const;
+    inline QList<QRect> freeRects() const { return rects; }
+
+protected:
+    static void prune(QList<QRect> &rects);
+
+private:
+    QRect bounds;
+    QList<QRect> rects;
+};
+
+}
+
+#endif   // FREERECTPACKER_H
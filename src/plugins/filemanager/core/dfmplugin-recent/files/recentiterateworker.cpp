@@ -12,10 +12,13 @@
 #include <dfm-base/base/device/deviceutils.h>
 
 #include <QDir>
+#include <QFileInfo>
+#include <QCryptographicHash>
 #include <QXmlStreamReader>
 #include <QUrl>
 #include <QMetaType>
 #include <QList>
+#include <QSet>
 #include <QMutexLocker>
 
 DFMBASE_USE_NAMESPACE
@@ -28,13 +31,62 @@ RecentIterateWorker::RecentIterateWorker()
 
 void RecentIterateWorker::onRecentFileChanged(const QList<QUrl> &cachedUrls)
 {
-    QFile file(RecentHelper::xbelPath());
-    QList<QUrl> urlList;
+    if (!loadBookmarks())
+        return;
+
+    const QSet<QUrl> &cachedUrlSet { cachedUrls.toSet() };
+    QSet<QUrl> urlSet;
+    urlSet.reserve(parsedBookmarks.size());
+    QHash<QString, QString> bindPaths;
+    bindPaths.reserve(parsedBookmarks.size());
+
+    for (const auto &bookmark : parsedBookmarks) {
+        if (stopped)
+            return;
+
+        QUrl recentUrl;
+        if (!resolveRecentUrl(bookmark.location, &bindPaths, &recentUrl))
+            continue;
+
+        urlSet.insert(recentUrl);
+        // the recent manager keeps the first record of an url, only new ones need to be sent
+        if (!cachedUrlSet.contains(recentUrl))
+            emit updateRecentFileInfo(recentUrl, bookmark.location, bookmark.readTime);
+    }
+
+    // only keep the bind paths of current bookmarks
+    bindPathCache.swap(bindPaths);
+
+    // delete cached recent file when recent file removed
+    QList<QUrl> deletedUrls;
+    for (const QUrl &url : cachedUrls) {
+        if (!urlSet.contains(url))
+            deletedUrls << url;
+    }
+    if (!deletedUrls.isEmpty())
+        emit deleteExistRecentUrls(deletedUrls);
+}
+
+void RecentIterateWorker::stop()
+{
+    stopped = true;
+}
 
+bool RecentIterateWorker::loadBookmarks()
+{
+    QFile file(RecentHelper::xbelPath());
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
-        return;
+        return false;
 
-    QXmlStreamReader reader(&file);
+    // applications always rewrite the whole xbel file, so the same size and digest
+    // means the content has been parsed already
+    const QByteArray &content = file.readAll();
+    const QByteArray &digest = QCryptographicHash::hash(content, QCryptographicHash::Md5);
+    if (content.size() == parsedSize && digest == parsedDigest)
+        return true;
+
+    QList<RecentBookmark> bookmarks;
+    QXmlStreamReader reader(content);
     while (!reader.atEnd()) {
         if (reader.readNext() == QXmlStreamReader::EndDocument)
             continue;
@@ -49,43 +101,54 @@ void RecentIterateWorker::onRecentFileChanged(const QList<QUrl> &cachedUrls)
             continue;
 
         if (stopped)
-            return;
-
-        const QUrl &url { QUrl(location) };
-        if (DeviceUtils::isLowSpeedDevice(url))
-            continue;
+            return false;
 
-        auto info = InfoFactory::create<FileInfo>(url, Global::CreateFileInfoType::kCreateFileInfoSync);
-        if (stopped)
-            return;
-        if (info && info->exists() && info->isAttributes(OptInfoType::kIsFile)) {
-            const auto &bindPath = FileUtils::bindPathTransform(info->pathOf(PathInfoType::kAbsoluteFilePath), false);
-            QUrl recentUrl { QUrl::fromLocalFile(bindPath) };
-            recentUrl.setScheme(RecentHelper::scheme());
-            qint64 readTimeSecs = QDateTime::fromString(readTime, Qt::ISODate).toSecsSinceEpoch();
-            urlList.append(recentUrl);
-            emit updateRecentFileInfo(recentUrl, location, readTimeSecs);
-        }
+        bookmarks.append({ location, QDateTime::fromString(readTime, Qt::ISODate).toSecsSinceEpoch() });
     }
 
     if (reader.hasError()) {
         fmWarning() << "Read recent xml file has error! Error: " << reader.errorString();
-        return;
+        return false;
     }
 
-    // delete cached recent file when recent file removed
-    QList<QUrl> deletedUrls;
-    for (const QUrl &url : cachedUrls) {
-        if (!urlList.contains(url))
-            deletedUrls << url;
-    }
-    if (!deletedUrls.isEmpty())
-        emit deleteExistRecentUrls(deletedUrls);
+    parsedSize = content.size();
+    parsedDigest = digest;
+    parsedBookmarks = bookmarks;
+    return true;
 }
 
-void RecentIterateWorker::stop()
+bool RecentIterateWorker::resolveRecentUrl(const QString &location, QHash<QString, QString> *bindPaths, QUrl *recentUrl)
 {
-    stopped = true;
+    Q_ASSERT(bindPaths && recentUrl);
+
+    const QUrl &url { QUrl(location) };
+    if (DeviceUtils::isLowSpeedDevice(url))
+        return false;
+
+    QString absoluteFilePath;
+    if (url.isLocalFile()) {
+        // a plain stat is enough here, creating a sync FileInfo for each bookmark is expensive
+        const QFileInfo info(url.toLocalFile());
+        if (!info.isFile())
+            return false;
+        absoluteFilePath = info.absoluteFilePath();
+    } else {
+        auto info = InfoFactory::create<FileInfo>(url, Global::CreateFileInfoType::kCreateFileInfoSync);
+        if (!info || !info->exists() || !info->isAttributes(OptInfoType::kIsFile))
+            return false;
+        absoluteFilePath = info->pathOf(PathInfoType::kAbsoluteFilePath);
+    }
+
+    // the fstab bind table is consulted only once for each path
+    auto it = bindPathCache.constFind(absoluteFilePath);
+    const QString &bindPath = it != bindPathCache.constEnd()
+            ? it.value()
+            : FileUtils::bindPathTransform(absoluteFilePath, false);
+    bindPaths->insert(absoluteFilePath, bindPath);
+
+    *recentUrl = QUrl::fromLocalFile(bindPath);
+    recentUrl->setScheme(RecentHelper::scheme());
+    return true;
 }
 
 }   // namespace dfmplugin_recent
@@ -8,6 +8,8 @@
 #include "dfmplugin_recent_global.h"
 
 #include <QObject>
+#include <QHash>
+#include <QUrl>
 
 namespace dfmplugin_recent {
 
@@ -15,6 +17,12 @@ class RecentIterateWorker : public QObject
 {
     Q_OBJECT
 
+    struct RecentBookmark
+    {
+        QString location;
+        qint64 readTime { 0 };
+    };
+
 public:
     RecentIterateWorker();
 
@@ -26,8 +34,20 @@ public:
 signals:
     void updateRecentFileInfo(const QUrl &url, const QString originPath, qint64 readTime);
     void deleteExistRecentUrls(const QList<QUrl> &urls);
+
+private:
+    bool loadBookmarks();
+    bool resolveRecentUrl(const QString &location, QHash<QString, QString> *bindPaths, QUrl *recentUrl);
+
 private:
     std::atomic_bool stopped{ false };
+
+    // the parsed xbel content, reused until the file is rewritten
+    qint64 parsedSize { -1 };
+    QByteArray parsedDigest;
+    QList<RecentBookmark> parsedBookmarks;
+    // absolute file path -> bind path transformed path
+    QHash<QString, QString> bindPathCache;
 };
 }
 #endif   // RECENTITERATEWORKER_H
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "completionindex.h"
+
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/dfm_global_defines.h>
+
+#include <QtConcurrent>
+#include <QDir>
+#include <QFileInfo>
+
+#include <algorithm>
+
+using namespace dfmplugin_titlebar;
+DFMBASE_USE_NAMESPACE
+
+static constexpr int kMaxListingCount { 16 };
+
+CompletionIndex *CompletionIndex::instance()
+{
+    static CompletionIndex ins;
+    return &ins;
+}
+
+CompletionIndex::CompletionIndex(QObject *parent)
+    : QObject(parent), listings(kMaxListingCount)
+{
+    worker.setMaxThreadCount(1);
+}
+
+CompletionIndex::~CompletionIndex()
+{
+    worker.clear();
+    worker.waitForDone();
+}
+
+/*!
+ * \brief List the sub folders of \a dir in the worker thread, listed is emitted when it is done.
+ *
+ * A local directory that is not modified since it was listed is not listed again.
+ */
+void CompletionIndex::request(const QUrl &dir)
+{
+    const QUrl &url = normalizedUrl(dir);
+    {
+        QMutexLocker lk(&mutex);
+        if (listingDirs.contains(url))
+            return;
+
+        if (Listing *listing = listings.object(url)) {
+            if (listing->modified >= 0 && listing->modified == localModifiedTime(url)) {
+                lk.unlock();
+                QMetaObject::invokeMethod(this, "listed", Qt::QueuedConnection, Q_ARG(QUrl, url));
+                return;
+            }
+        }
+        listingDirs.insert(url);
+    }
+
+    QtConcurrent::run(&worker, [this, url]() {
+        listFolders(url);
+    });
+}
+
+/*!
+ * \brief Get at most \a limit names that start with \a prefix in the listed \a dir.
+ *
+ * \return false if the \a dir is not listed.
+ */
+bool CompletionIndex::find(const QUrl &dir, const QString &prefix, int limit, QStringList *names)
+{
+    QMutexLocker lk(&mutex);
+    Listing *listing = listings.object(normalizedUrl(dir));
+    if (!listing)
+        return false;
+
+    *names = match(listing->names, prefix, limit);
+    return true;
+}
+
+QStringList CompletionIndex::match(const QStringList &sortedNames, const QString &prefix, int limit)
+{
+    QStringList names;
+    auto it = std::lower_bound(sortedNames.cbegin(), sortedNames.cend(), prefix);
+    for (; it != sortedNames.cend() && names.count() < limit; ++it) {
+        if (!it->startsWith(prefix))
+            break;
+        names.append(*it);
+    }
+
+    return names;
+}
+
+void CompletionIndex::listFolders(const QUrl &dir)
+{
+    const qint64 modified = localModifiedTime(dir);
+    QStringList names;
+    auto iterator = DirIteratorFactory::create<AbstractDirIterator>(dir, QStringList(),
+                                                                    QDir::Dirs | QDir::Hidden | QDir::NoDotAndDotDot,
+                                                                    QDirIterator::NoIteratorFlags);
+    if (iterator) {
+        iterator->cacheBlockIOAttribute();
+        const bool isLocal = dir.isLocalFile();
+        while (iterator->hasNext()) {
+            const QUrl &child = iterator->next();
+            if (!child.isValid())
+                continue;
+
+            QString name;
+            if (isLocal) {
+                name = child.fileName();
+            } else if (auto info = InfoFactory::create<FileInfo>(child)) {
+                name = info->nameOf(NameInfoType::kFileName);
+            }
+
+            if (!name.isEmpty())
+                names.append(name);
+        }
+    } else {
+        fmWarning() << "Failed create dir iterator for completion:" << dir;
+    }
+
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    {
+        QMutexLocker lk(&mutex);
+        listingDirs.remove(dir);
+        listings.insert(dir, new Listing { names, modified });
+    }
+
+    Q_EMIT listed(dir);
+}
+
+QUrl CompletionIndex::normalizedUrl(const QUrl &dir)
+{
+    QUrl url(dir);
+    QString path = url.path();
+    if (path.length() > 1 && path.endsWith(QDir::separator())) {
+        path.chop(1);
+        url.setPath(path);
+    }
+
+    return url;
+}
+
+qint64 CompletionIndex::localModifiedTime(const QUrl &dir)
+{
+    if (!dir.isLocalFile())
+        return -1;
+
+    QFileInfo info(dir.toLocalFile());
+    if (!info.exists())
+        return -1;
+
+    return info.lastModified().toMSecsSinceEpoch();
+}
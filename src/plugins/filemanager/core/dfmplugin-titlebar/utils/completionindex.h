@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef COMPLETIONINDEX_H
+#define COMPLETIONINDEX_H
+
+#include "dfmplugin_titlebar_global.h"
+
+#include <QObject>
+#include <QCache>
+#include <QMutex>
+#include <QSet>
+#include <QThreadPool>
+
+namespace dfmplugin_titlebar {
+
+// the sorted sub folder names of the directories that the address bar completes,
+// all the crumb controllers share it and its worker thread.
+class CompletionIndex : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(CompletionIndex)
+
+    struct Listing
+    {
+        QStringList names;
+        qint64 modified { -1 };
+    };
+
+public:
+    static CompletionIndex *instance();
+
+    void request(const QUrl &dir);
+    bool find(const QUrl &dir, const QString &prefix, int limit, QStringList *names);
+    static QStringList match(const QStringList &sortedNames, const QString &prefix, int limit);
+
+Q_SIGNALS:
+    void listed(const QUrl &dir);
+
+private:
+    explicit CompletionIndex(QObject *parent = nullptr);
+    ~CompletionIndex() override;
+
+    void listFolders(const QUrl &dir);
+    static QUrl normalizedUrl(const QUrl &dir);
+    static qint64 localModifiedTime(const QUrl &dir);
+
+    QMutex mutex;
+    QCache<QUrl, Listing> listings;
+    QSet<QUrl> listingDirs;
+    QThreadPool worker;
+};
+
+}
+
+#endif   // COMPLETIONINDEX_H
@@ -4,6 +4,7 @@
 
 #include "crumbinterface.h"
 #include "utils/titlebarhelper.h"
+#include "utils/completionindex.h"
 
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/base/schemefactory.h>
@@ -16,9 +17,13 @@
 using namespace dfmplugin_titlebar;
 DFMBASE_USE_NAMESPACE
 
+// only the first matches are put into the completer, the popup shows 10 of them at a time.
+static constexpr int kMaxCompletionCount { 200 };
+
 CrumbInterface::CrumbInterface(QObject *parent)
     : QObject(parent)
 {
+    connect(CompletionIndex::instance(), &CompletionIndex::listed, this, &CrumbInterface::onCompletionListed);
 }
 
 void CrumbInterface::setKeepAddressBar(bool keep)
@@ -106,41 +111,40 @@ QList<CrumbData> CrumbInterface::seprateUrl(const QUrl &url)
  * \brief Start request a completion list for address bar auto-completion.
  *
  * \param url The base url need to be completed.
+ * \param prefix The text typed after the base url.
  *
- * Since completion list can be long, so we need do async completion. Calling this
- * function will start a completion request and the completion list item will be sent
- * via signal completionFound. When user no longer need current completion list and
- * the transmission isn't completed, you should call cancelCompletionListTransmission.
- * When transmission completed, it will send completionListTransmissionCompleted signal.
+ * The sub folders of \a url are listed by the worker thread of CompletionIndex, which
+ * keeps a sorted listing of recently completed directories. When it is ready, the names
+ * that start with \a prefix are sent via signal completionFound, followed by
+ * completionListTransmissionCompleted. When user no longer need current completion list
+ * and the transmission isn't completed, you should call cancelCompletionListTransmission.
  *
  * \sa completionFound, completionListTransmissionCompleted, cancelCompletionListTransmission
  */
-void CrumbInterface::requestCompletionList(const QUrl &url)
+void CrumbInterface::requestCompletionList(const QUrl &url, const QString &prefix)
 {
-    if (folderCompleterJobPointer) {
-        folderCompleterJobPointer->disconnect();
-        folderCompleterJobPointer->stopAndDeleteLater();
-        folderCompleterJobPointer->setParent(nullptr);
-    }
-    folderCompleterJobPointer = new TraversalDirThread(url, QStringList(),
-                                                       QDir::Dirs | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::NoIteratorFlags);
-    folderCompleterJobPointer->setParent(this);
-    if (folderCompleterJobPointer.isNull())
+    completionUrl = url;
+    completionPrefix = prefix;
+    completionPending = true;
+    CompletionIndex::instance()->request(url);
+}
+
+/*!
+ * \brief Send the completions of the current base url that start with \a prefix.
+ *
+ * Nothing is sent if the listing is not ready, it will be sent with the new prefix when it is.
+ *
+ * \sa requestCompletionList
+ */
+void CrumbInterface::updateCompletionPrefix(const QString &prefix)
+{
+    completionPrefix = prefix;
+    if (completionPending || !completionUrl.isValid())
         return;
 
-    connect(folderCompleterJobPointer.data(), &TraversalDirThread::updateChildren, this,
-            &CrumbInterface::onUpdateChildren, Qt::DirectConnection);
-
-    connect(
-            folderCompleterJobPointer.data(), &TraversalDirThread::finished, this,
-            [this]() {
-                emit completionListTransmissionCompleted();
-            },
-            Qt::QueuedConnection);
-    // TODO(liyigang): imple follow interfaces
-    //    folderCompleterJobPointer->setTimeCeiling(1000);
-    //    folderCompleterJobPointer->setCountCeiling(500);
-    folderCompleterJobPointer->start();
+    QStringList names;
+    if (CompletionIndex::instance()->find(completionUrl, completionPrefix, kMaxCompletionCount, &names))
+        emit completionFound(names);
 }
 
 /*!
@@ -150,18 +154,17 @@ void CrumbInterface::requestCompletionList(const QUrl &url)
  */
 void CrumbInterface::cancelCompletionListTransmission()
 {
-    if (folderCompleterJobPointer)
-        folderCompleterJobPointer->stop();
+    completionPending = false;
 }
 
-void CrumbInterface::onUpdateChildren(QList<QUrl> children)
+void CrumbInterface::onCompletionListed(const QUrl &dir)
 {
-    QStringList list;
+    if (!completionPending || !UniversalUtils::urlEquals(dir, completionUrl))
+        return;
 
-    for (const auto &child : children) {
-        auto info = InfoFactory::create<FileInfo>(child);
-        if (info)
-            list.append(info->nameOf(NameInfoType::kFileName));
-    }
-    emit completionFound(list);
+    completionPending = false;
+    QStringList names;
+    if (CompletionIndex::instance()->find(completionUrl, completionPrefix, kMaxCompletionCount, &names))
+        emit completionFound(names);
+    emit completionListTransmissionCompleted();
 }
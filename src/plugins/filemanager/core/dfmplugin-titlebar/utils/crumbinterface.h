@@ -7,10 +7,7 @@
 
 #include "dfmplugin_titlebar_global.h"
 
-#include <dfm-base/utils/traversaldirthread.h>
-
 #include <QObject>
-#include <QPointer>
 
 namespace dfmplugin_titlebar {
 
@@ -36,7 +33,8 @@ public:
     void processAction(ActionType type);
     void crumbUrlChangedBehavior(const QUrl &url);
     FAKE_VIRTUAL QList<CrumbData> seprateUrl(const QUrl &url);
-    void requestCompletionList(const QUrl &url);
+    void requestCompletionList(const QUrl &url, const QString &prefix = QString());
+    void updateCompletionPrefix(const QString &prefix);
     void cancelCompletionListTransmission();
 
 signals:
@@ -44,16 +42,18 @@ signals:
     void pauseSearch();
     void keepAddressBar(const QUrl &url);
     void hideAddrAndUpdateCrumbs(const QUrl &url);
-    void completionFound(const QStringList &completions);   //< emit multiple times with less or equials to 10 items in a group.
+    void completionFound(const QStringList &completions);   //< the names start with the completion prefix, at most kMaxCompletionCount.
     void completionListTransmissionCompleted();   //< emit when all avaliable completions has been sent.
 
 private slots:
-    void onUpdateChildren(QList<QUrl> children);
+    void onCompletionListed(const QUrl &dir);
 
 private:
     QString curScheme;
     bool keepAddr { false };
-    QPointer<DFMBASE_NAMESPACE::TraversalDirThread> folderCompleterJobPointer;
+    QUrl completionUrl;
+    QString completionPrefix;
+    bool completionPending { false };
 };
 
 }
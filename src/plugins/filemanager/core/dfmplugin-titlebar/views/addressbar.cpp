@@ -285,14 +285,19 @@ void AddressBarPrivate::doComplete()
 
 void AddressBarPrivate::appendToCompleterModel(const QStringList &stringList)
 {
+    QList<QStandardItem *> items;
+    items.reserve(stringList.count());
     for (const QString &str : stringList) {
         // 防止出现空的补全提示
         if (str.isEmpty())
             continue;
 
-        QStandardItem *item = new QStandardItem(str);
-        completerModel.appendRow(item);
+        items.append(new QStandardItem(str));
     }
+
+    // insert the items in one go to make the completer filter once.
+    if (!items.isEmpty())
+        completerModel.invisibleRootItem()->appendRows(items);
 }
 
 void AddressBarPrivate::onTravelCompletionListFinished()
@@ -397,7 +402,7 @@ void AddressBarPrivate::requestCompleteByUrl(const QUrl &url)
         connect(crumbController, &CrumbInterface::completionFound, this, &AddressBarPrivate::appendToCompleterModel);
         connect(crumbController, &CrumbInterface::completionListTransmissionCompleted, this, &AddressBarPrivate::onTravelCompletionListFinished);
     }
-    crumbController->requestCompletionList(url);
+    crumbController->requestCompletionList(url, urlCompleter->completionPrefix());
 }
 
 void AddressBarPrivate::completeSearchHistory(const QString &text)
@@ -468,6 +473,11 @@ void AddressBarPrivate::completeLocalPath(const QString &text, const QUrl &url,
     if (!isHistoryInCompleterModel
         && (this->completerBaseString == text.left(slashIndex + 1)
             || UrlRoute::fromUserInput(completerBaseString) == UrlRoute::fromUserInput(text.left(slashIndex + 1)))) {
+        // only the first matches of the prefix are in the model, refill it by the new prefix.
+        if (crumbController) {
+            completerModel.removeAll();
+            crumbController->updateCompletionPrefix(text.mid(slashIndex + 1));
+        }
         urlCompleter->setCompletionPrefix(text.mid(slashIndex + 1));   // set completion prefix first
         onCompletionModelCountChanged();   // will call complete()
         return;
@@ -168,6 +168,12 @@ int RootInfo::clearTraversalThread(const QString &key, const bool isRefresh)
     return traversalThreads.count();
 }
 
+int RootInfo::childrenCount()
+{
+    QReadLocker lk(&childrenLock);
+    return sourceDataList.count();
+}
+
 void RootInfo::reset()
 {
     {
@@ -352,16 +358,20 @@ void RootInfo::handleTraversalResults(const QList<FileInfoPointer> children, con
 
 void RootInfo::handleTraversalLocalResult(QList<SortInfoPointer> children,
                                           dfmio::DEnumerator::SortRoleCompareFlag sortRole,
-                                          Qt::SortOrder sortOrder, bool isMixDirAndFile, const QString &travseToken)
+                                          Qt::SortOrder sortOrder, bool isMixDirAndFile, const QString &travseToken,
+                                          bool isFinished)
 {
-    originSortRole = sortRole;
+    // every run is sorted on its own, the source data as a whole is not,
+    // so the views reusing it have to sort it again.
+    originSortRole = dfmio::DEnumerator::SortRoleCompareFlag::kSortRoleCompareDefault;
     originSortOrder = sortOrder;
     originMixSort = isMixDirAndFile;
 
     addChildren(children);
-    traversaling = false;
+    if (isFinished)
+        traversaling = false;
 
-    Q_EMIT iteratorLocalFiles(travseToken, children, originSortRole, originSortOrder, originMixSort);
+    Q_EMIT iteratorLocalFiles(travseToken, children, sortRole, originSortOrder, originMixSort, isFinished);
 }
 
 void RootInfo::handleTraversalFinish(const QString &travseToken)
@@ -442,11 +452,13 @@ void RootInfo::addChildren(const QList<FileInfoPointer> &children)
 
 void RootInfo::addChildren(const QList<SortInfoPointer> &children)
 {
+    QWriteLocker lk(&childrenLock);
+    childrenUrlList.reserve(childrenUrlList.size() + children.size());
+    sourceDataList.reserve(sourceDataList.size() + children.size());
     for (auto &file : children) {
         if (!file)
             continue;
 
-        QWriteLocker lk(&childrenLock);
         childrenUrlList.append(file->fileUrl());
         sourceDataList.append(file);
     }
@@ -481,7 +493,7 @@ SortInfoPointer RootInfo::sortFileInfo(const FileInfoPointer &info)
 {
     if (!info)
         return nullptr;
-    SortInfoPointer sortInfo(new SortFileInfo);
+    auto sortInfo = SortInfoPointer::create();
     sortInfo->setUrl(info->urlOf(UrlInfoType::kUrl));
     sortInfo->setSize(info->size());
     sortInfo->setFile(!info->isAttributes(OptInfoType::kIsDir));
@@ -47,6 +47,8 @@ public:
                               DFMGLOBAL_NAMESPACE::ItemRoles role, Qt::SortOrder order, bool isMixFileAndFolder);
     void startWork(const QString &key, const bool getCache = false);
     int clearTraversalThread(const QString &key, const bool isRefresh);
+    int childrenCount();
+    bool isTraversalFinished() const { return traversalFinish; }
 
     void reset();
 
@@ -64,7 +66,8 @@ Q_SIGNALS:
                             const QList<SortInfoPointer> children,
                             const dfmio::DEnumerator::SortRoleCompareFlag sortRole,
                             const Qt::SortOrder sortOrder,
-                            const bool isMixDirAndFile);
+                            const bool isMixDirAndFile,
+                            const bool isFinished);
     void iteratorAddFile(const QString &key, const SortInfoPointer sortInfo, const FileInfoPointer info);
     void iteratorAddFiles(const QString &key, const QList<SortInfoPointer> sortInfos, const QList<FileInfoPointer> infos);
     void watcherAddFiles(const QList<SortInfoPointer> &children);
@@ -99,7 +102,8 @@ public Q_SLOTS:
     void handleTraversalLocalResult(QList<SortInfoPointer> children,
                                     dfmio::DEnumerator::SortRoleCompareFlag sortRole,
                                     Qt::SortOrder sortOrder,
-                                    bool isMixDirAndFile, const QString &travseToken);
+                                    bool isMixDirAndFile, const QString &travseToken,
+                                    bool isFinished = true);
     void handleTraversalFinish(const QString &travseToken);
 
     void handleTraversalSort(const QString &travseToken);
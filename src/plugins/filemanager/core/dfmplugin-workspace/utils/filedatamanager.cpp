@@ -9,12 +9,19 @@
 #include <dfm-base/utils/fileutils.h>
 #include <dfm-base/utils/watchercache.h>
 #include <dfm-base/base/schemefactory.h>
+#include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 
 #include <QApplication>
 
+#include <sys/stat.h>
+
 using namespace dfmbase;
 using namespace dfmplugin_workspace;
 
+namespace DConfigKeys {
+static constexpr char kSnapshotLimit[] { "dfm.workspace.snapshot.limit" };
+}
+
 FileDataManager *FileDataManager::instance()
 {
     static FileDataManager ins;
@@ -23,8 +30,15 @@ FileDataManager *FileDataManager::instance()
 
 RootInfo *FileDataManager::fetchRoot(const QUrl &url)
 {
-    if (rootInfoMap.contains(url))
-        return rootInfoMap.value(url);
+    if (rootInfoMap.contains(url)) {
+        if (!snapshots.contains(url) || takeSnapshot(url))
+            return rootInfoMap.value(url);
+
+        // the directory is changed, drop the snapshot.
+        auto root = rootInfoMap.take(url);
+        if (root)
+            root->deleteLater();
+    }
 
     return createRoot(url);
 }
@@ -55,12 +69,18 @@ void FileDataManager::cleanRoot(const QUrl &rootUrl, const QString &key, const b
             if (count > 0)
                 continue;
             if (!checkNeedCache(rootInfo) || refresh) {
+                if (!refresh && parkRoot(rootInfo, rootInfoMap.value(rootInfo)))
+                    continue;
+
+                dropSnapshot(rootInfo);
                 auto root = rootInfoMap.take(rootInfo);
                 if (root)
                     root->deleteLater();
             }
         }
     }
+
+    evictSnapshots();
 }
 
 void FileDataManager::cleanRoot(const QUrl &rootUrl)
@@ -72,6 +92,7 @@ void FileDataManager::cleanRoot(const QUrl &rootUrl)
     auto rootInfoKeys = rootInfoMap.keys();
     for (const auto &rootInfo : rootInfoKeys) {
         if (rootInfo.path().startsWith(rootPath) || rootInfo.path() == rootUrl.path()) {
+            dropSnapshot(rootInfo);
             rootInfoMap.value(rootInfo)->disconnect();
             auto root = rootInfoMap.take(rootInfo);
             if (root)
@@ -104,6 +125,14 @@ FileDataManager::FileDataManager(QObject *parent)
     isMixFileAndFolder = Application::instance()->appAttribute(Application::kFileAndDirMixedSort).toBool();
     connect(Application::instance(), &Application::appAttributeChanged, this, &FileDataManager::onAppAttributeChanged);
 
+    // in MiB, 0 disables the snapshots of local directories.
+    snapshotByteLimit = DConfigManager::instance()->value(kDefaultCfgPath, DConfigKeys::kSnapshotLimit, 64).toLongLong() * 1024 * 1024;
+    connect(DConfigManager::instance(), &DConfigManager::valueChanged, this, [this](const QString &config, const QString &key) {
+        if (config != kDefaultCfgPath || key != DConfigKeys::kSnapshotLimit)
+            return;
+        snapshotByteLimit = DConfigManager::instance()->value(kDefaultCfgPath, DConfigKeys::kSnapshotLimit, 64).toLongLong() * 1024 * 1024;
+        evictSnapshots();
+    });
 }
 
 FileDataManager::~FileDataManager()
@@ -116,7 +145,8 @@ FileDataManager::~FileDataManager()
 RootInfo *FileDataManager::createRoot(const QUrl &url)
 {
     // create a new RootInfo
-    RootInfo *root = new RootInfo(url, checkNeedCache(url));
+    // local roots reuse their data only when they can be kept as a snapshot.
+    RootInfo *root = new RootInfo(url, checkNeedCache(url) || (snapshotByteLimit > 0 && url.isLocalFile()));
 
     // insert it to rootInfoMap
     rootInfoMap.insert(url, root);
@@ -137,3 +167,76 @@ bool FileDataManager::checkNeedCache(const QUrl &url)
 
     return false;
 }
+
+bool FileDataManager::parkRoot(const QUrl &url, RootInfo *root)
+{
+    if (!root || snapshotByteLimit <= 0 || !root->isTraversalFinished())
+        return false;
+
+    RootSnapshot snapshot;
+    if (!dirStat(url, &snapshot.mtime, &snapshot.inode))
+        return false;
+
+    snapshot.bytes = root->childrenCount() * kSnapshotBytesPerChild;
+    if (snapshot.bytes > snapshotByteLimit)
+        return false;
+
+    dropSnapshot(url);
+    snapshots.insert(url, snapshot);
+    snapshotOrder.append(url);
+    snapshotBytes += snapshot.bytes;
+    return true;
+}
+
+bool FileDataManager::takeSnapshot(const QUrl &url)
+{
+    if (!snapshots.contains(url))
+        return false;
+
+    const RootSnapshot snapshot = snapshots.value(url);
+    dropSnapshot(url);
+
+    qint64 mtime = 0;
+    quint64 inode = 0;
+    if (!dirStat(url, &mtime, &inode) || inode != snapshot.inode)
+        return false;
+
+    // the watcher keeps the children in step with the directory,
+    // without it the directory must not be modified since it was left.
+    auto root = rootInfoMap.value(url);
+    return root && (root->watcher || mtime == snapshot.mtime);
+}
+
+void FileDataManager::dropSnapshot(const QUrl &url)
+{
+    if (!snapshots.contains(url))
+        return;
+
+    snapshotBytes -= snapshots.take(url).bytes;
+    snapshotOrder.removeOne(url);
+}
+
+void FileDataManager::evictSnapshots()
+{
+    while (snapshotBytes > snapshotByteLimit && !snapshotOrder.isEmpty()) {
+        const QUrl url = snapshotOrder.first();
+        dropSnapshot(url);
+        auto root = rootInfoMap.take(url);
+        if (root)
+            root->deleteLater();
+    }
+}
+
+bool FileDataManager::dirStat(const QUrl &url, qint64 *mtime, quint64 *inode)
+{
+    if (!url.isLocalFile())
+        return false;
+
+    struct stat st;
+    if (::stat(url.toLocalFile().toLocal8Bit().constData(), &st) != 0)
+        return false;
+
+    *mtime = static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    *inode = static_cast<quint64>(st.st_ino);
+    return true;
+}
@@ -20,6 +20,17 @@ class FileItemData;
 class FileDataManager : public QObject
 {
     Q_OBJECT
+
+    // a local root kept after all the views left it, see parkRoot
+    struct RootSnapshot
+    {
+        qint64 bytes { 0 };
+        qint64 mtime { 0 };
+        quint64 inode { 0 };
+    };
+    // rough memory of a child kept by RootInfo: the sort info, its url and the path strings.
+    static constexpr qint64 kSnapshotBytesPerChild { 512 };
+
 public:
     static FileDataManager *instance();
 
@@ -45,6 +56,11 @@ private:
     RootInfo *createRoot(const QUrl &url);
 
     bool checkNeedCache(const QUrl &url);
+    bool parkRoot(const QUrl &url, RootInfo *root);
+    bool takeSnapshot(const QUrl &url);
+    void dropSnapshot(const QUrl &url);
+    void evictSnapshots();
+    static bool dirStat(const QUrl &url, qint64 *mtime, quint64 *inode);
 
     QMap<QUrl, RootInfo *> rootInfoMap {};
     QMap<QUrl, TraversalThreadPointer> traversalPointerMap {};
@@ -54,6 +70,12 @@ private:
     // scheme in cacheDataSchemes will have cache
     QList<QString> cacheDataSchemes {};
     QMap<QUrl, int> dataRefMap {};
+
+    // snapshots of local roots, the least recently used is at the front.
+    QMap<QUrl, RootSnapshot> snapshots {};
+    QList<QUrl> snapshotOrder {};
+    qint64 snapshotBytes { 0 };
+    qint64 snapshotByteLimit { 0 };
 };
 
 }
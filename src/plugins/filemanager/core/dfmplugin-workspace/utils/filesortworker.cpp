@@ -10,11 +10,15 @@
 #include <dfm-base/utils/fileinfohelper.h>
 #include <dfm-base/base/standardpaths.h>
 #include <dfm-base/utils/universalutils.h>
+#include <dfm-base/utils/hidefilehelper.h>
 #include "workspacehelper.h"
 
 #include <dfm-io/dfmio_utils.h>
 
 #include <QStandardPaths>
+#include <QFileInfo>
+
+#include <algorithm>
 
 using namespace dfmplugin_workspace;
 using namespace dfmbase::Global;
@@ -168,9 +172,24 @@ void FileSortWorker::handleIteratorLocalChildren(const QString &key,
                                                  const QList<SortInfoPointer> children,
                                                  const DEnumerator::SortRoleCompareFlag sortRole,
                                                  const Qt::SortOrder sortOrder,
-                                                 const bool isMixDirAndFile)
+                                                 const bool isMixDirAndFile,
+                                                 const bool isFinished)
 {
-    handleAddChildren(key, children, {}, sortRole, sortOrder, isMixDirAndFile, false, false);
+    Q_UNUSED(sortRole)
+    Q_UNUSED(sortOrder)
+    Q_UNUSED(isMixDirAndFile)
+    Q_UNUSED(isFinished)
+
+    if (children.isEmpty())
+        return;
+
+    // every run arrives sorted on its own, merge it into the children added before
+    const auto &parentUrl = parantUrl(children.first()->fileUrl());
+    const int runStart = visibleTreeChildren.value(parentUrl).length();
+    if (!handleAddChildren(key, children, {}))
+        return;
+
+    mergeSortedRun(parentUrl, runStart);
 }
 
 void FileSortWorker::handleSourceChildren(const QString &key,
@@ -405,7 +424,10 @@ void FileSortWorker::handleWatcherUpdateHideFile(const QUrl &hidUrl)
     auto hiddenFileInfo = InfoFactory::create<FileInfo>(hidUrl);
     if (!hiddenFileInfo)
         return;
-    auto hidlist = DFMUtils::hideListFromUrl(QUrl::fromLocalFile(hiddenFileInfo->pathOf(PathInfoType::kFilePath)));
+    // the .hidden file is changed, drop the shared one.
+    const QString &hiddenDir = QFileInfo(hiddenFileInfo->pathOf(PathInfoType::kFilePath)).absolutePath();
+    HideFileHelper::invalidateHideList(hiddenDir);
+    auto hidlist = HideFileHelper::hideListOf(hiddenDir);
     auto parentUrl = parantUrl(hidUrl);
     for (const auto &child : children.value(parentUrl)) {
         if (isCanceled)
@@ -725,11 +747,12 @@ bool FileSortWorker::handleAddChildren(const QString &key,
     // 获取深度
     auto depth = findDepth(parentUrl);
     for (const auto &sortInfo : children) {
-        if (tmpChildren.contains(sortInfo->fileUrl()))
+        const QUrl &url = sortInfo->fileUrl();
+        if (tmpChildren.contains(url))
             continue;
-        tmpChildren.insert(sortInfo->fileUrl(), sortInfo);
+        tmpChildren.insert(url, sortInfo);
         if (checkFilters(sortInfo))
-            newChildren.append(sortInfo->fileUrl());
+            newChildren.append(url);
         if (isCanceled)
             return false;
         FileInfoPointer info { nullptr };
@@ -1104,6 +1127,37 @@ QList<QUrl> FileSortWorker::sortAllTreeFilesByParent(const QUrl &dir, const bool
     return visibleList;
 }
 
+void FileSortWorker::mergeSortedRun(const QUrl &parent, const int runStart)
+{
+    if (isCanceled || orgSortRole == Global::ItemRoles::kItemDisplayRole)
+        return;
+
+    auto sortList = visibleTreeChildren.value(parent);
+    if (runStart < 0 || runStart >= sortList.length())
+        return;
+
+    auto before = [this](const QUrl &left, const QUrl &right) {
+        return sortOrder == Qt::AscendingOrder
+                ? lessThan(left, right, AbstractSortFilter::SortScenarios::kSortScenariosNormal)
+                : lessThan(right, left, AbstractSortFilter::SortScenarios::kSortScenariosNormal);
+    };
+    const auto mid = sortList.begin() + runStart;
+    std::stable_sort(mid, sortList.end(), before);
+    // 已排好的部分中，第一个会被新的run挤后的位置
+    const int firstMoved = static_cast<int>(std::upper_bound(sortList.begin(), mid, *mid, before) - sortList.begin());
+    std::inplace_merge(sortList.begin(), mid, sortList.end(), before);
+    if (isCanceled)
+        return;
+
+    visibleTreeChildren.insert(parent, sortList);
+    const int startPos = findStartPos(parent);
+    if (startPos < 0)
+        return;
+
+    setVisibleChildren(startPos, sortList, InsertOpt::kInsertOptReplace, startPos + sortList.length());
+    Q_EMIT dataChanged(startPos + firstMoved, startPos + sortList.length() - 1);
+}
+
 QList<QUrl> FileSortWorker::sortTreeFiles(const QList<QUrl> &children, const bool reverse)
 {
     if (isCanceled || children.isEmpty())
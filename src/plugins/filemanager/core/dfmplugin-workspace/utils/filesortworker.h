@@ -96,7 +96,8 @@ public slots:
                                      const QList<SortInfoPointer> children,
                                      const DFMIO::DEnumerator::SortRoleCompareFlag sortRole,
                                      const Qt::SortOrder sortOrder,
-                                     const bool isMixDirAndFile);
+                                     const bool isMixDirAndFile,
+                                     const bool isFinished = true);
     void handleSourceChildren(const QString &key,
                               const QList<SortInfoPointer> children,
                               const DFMIO::DEnumerator::SortRoleCompareFlag sortRole,
@@ -172,6 +173,7 @@ private:
     void switchListView();
     QList<QUrl> sortAllTreeFilesByParent(const QUrl &dir, const bool reverse = false);
     QList<QUrl> sortTreeFiles(const QList<QUrl> &children, const bool reverse = false);
+    void mergeSortedRun(const QUrl &parent, const int runStart);
     QList<QUrl> removeChildrenByParents(const QList<QUrl> &dirs);
     QList<QUrl> removeVisibleTreeChildren(const QUrl &parent);
     void removeSubDir(const QUrl &dir);
@@ -76,13 +76,11 @@ bool FileViewHelper::isTransparent(const QModelIndex &index) const
     //  cutting
 
     if (ClipBoard::instance()->clipboardAction() == ClipBoard::kCutAction) {
-        QUrl localUrl = file->urlOf(UrlInfoType::kUrl);
-        auto cutUrls = ClipBoard::instance()->clipboardFileUrlList();
-        if (cutUrls.contains(localUrl))
+        if (ClipBoard::instance()->isCut(file->urlOf(UrlInfoType::kUrl)))
             return true;
 
         if (file->canAttributes(CanableInfoType::kCanRedirectionFileUrl))
-            return cutUrls.contains(QUrl::fromLocalFile(file->pathOf(PathInfoType::kAbsoluteFilePath)));
+            return ClipBoard::instance()->isCut(QUrl::fromLocalFile(file->pathOf(PathInfoType::kAbsoluteFilePath)));
     }
 
     return false;
@@ -154,7 +154,15 @@ void ItemDelegateHelper::hideTooltipImmediately()
 ElideTextLayout *ItemDelegateHelper::createTextLayout(const QString &name, QTextOption::WrapMode wordWrap,
                                                       qreal lineHeight, int alignmentFlag, QPainter *painter)
 {
-    ElideTextLayout *layout = new ElideTextLayout(name);
+    ElideTextLayout *layout = new ElideTextLayout;
+    initTextLayout(layout, name, wordWrap, lineHeight, alignmentFlag, painter);
+    return layout;
+}
+
+void ItemDelegateHelper::initTextLayout(ElideTextLayout *layout, const QString &name, QTextOption::WrapMode wordWrap,
+                                        qreal lineHeight, int alignmentFlag, QPainter *painter)
+{
+    layout->reset(name);
 
     layout->setAttribute(ElideTextLayout::kWrapMode, wordWrap);
     layout->setAttribute(ElideTextLayout::kLineHeight, lineHeight);
@@ -164,6 +172,4 @@ ElideTextLayout *ItemDelegateHelper::createTextLayout(const QString &name, QText
         layout->setAttribute(ElideTextLayout::kFont, painter->font());
         layout->setAttribute(ElideTextLayout::kTextDirection, painter->layoutDirection());
     }
-
-    return layout;
 }
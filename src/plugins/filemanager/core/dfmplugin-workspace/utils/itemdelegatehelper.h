@@ -65,6 +65,9 @@ public:
 
     static dfmbase::ElideTextLayout *createTextLayout(const QString &name, QTextOption::WrapMode wordWrap,
                                                       qreal lineHeight, int alignmentFlag, QPainter *painter = nullptr);
+    // reset \a layout to \a name and the given attributes, so that it can be reused for another item.
+    static void initTextLayout(dfmbase::ElideTextLayout *layout, const QString &name, QTextOption::WrapMode wordWrap,
+                               qreal lineHeight, int alignmentFlag, QPainter *painter = nullptr);
 
 private:
     static void drawBackground(const qreal &backgroundRadius, const QRectF &rect,
@@ -5,10 +5,15 @@
 #include "traversaldirthreadmanager.h"
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/file/local/localdiriterator.h>
+#include <dfm-base/utils/fileutils.h>
 
 #include <QElapsedTimer>
+#include <QDateTime>
 #include <QDebug>
 
+#include <algorithm>
+#include <iterator>
+
 typedef QList<QSharedPointer<DFMBASE_NAMESPACE::SortFileInfo>>& SortInfoList;
 
 using namespace dfmbase;
@@ -110,7 +115,6 @@ void TraversalDirThreadManager::run()
         const QList<SortInfoPointer> &fileList = iteratorAll();
         count = fileList.count();
         fmInfo() << "local dir query end, file count: " << count << " url: " << dirUrl << " elapsed: " << timer.elapsed();
-        createFileInfo(fileList);
     } else {
         count = iteratorOneByOne(timer);
         fmInfo() << "dir query end, file count: " << count << " url: " << dirUrl << " elapsed: " << timer.elapsed();
@@ -187,25 +191,130 @@ QList<SortInfoPointer> TraversalDirThreadManager::iteratorAll()
                 QVariant::fromValue(sortRole));
     args.insert("mixFileAndDir", isMixDirAndFile);
     args.insert("sortOrder", sortOrder);
+    // 逐个遍历，不等待dfm-io读完并排序整个目录
+    args.insert("oneByOne", true);
     dirIterator->setArguments(args);
+    dirIterator->cacheBlockIOAttribute();
     if (!dirIterator->initIterator()) {
         fmWarning() << "dir iterator init failed !! url : " << dirUrl;
         emit traversalFinished(traversalToken);
         return {};
     }
     Q_EMIT iteratorInitFinished();
-    auto fileList = dirIterator->sortFileInfoList();
 
-    emit updateLocalChildren(fileList, sortRole, sortOrder, isMixDirAndFile, traversalToken);
+    auto before = [this](const LocalEntry &left, const LocalEntry &right) {
+        // The folder is fixed in the front position
+        if (!isMixDirAndFile && left.info->isDir() != right.info->isDir())
+            return left.info->isDir();
+
+        const LocalEntry &first = sortOrder == Qt::AscendingOrder ? left : right;
+        const LocalEntry &second = sortOrder == Qt::AscendingOrder ? right : left;
+        if (first.value != second.value)
+            return first.value < second.value;
+        return FileUtils::compareByStringEx(first.name, second.name);
+    };
+    auto emitRun = [&](std::vector<LocalEntry> &entries, bool isFinished) {
+        std::sort(entries.begin(), entries.end(), before);
+        QList<SortInfoPointer> children;
+        children.reserve(static_cast<int>(entries.size()));
+        for (const auto &entry : entries)
+            children.append(entry.info);
+        entries.clear();
+        emit updateLocalChildren(children, sortRole, sortOrder, isMixDirAndFile, traversalToken, isFinished);
+    };
+
+    QList<SortInfoPointer> fileList;
+    // 首屏：在firstRunCeiling内只保留排在最前的countCeiling个，其余的留给后面的run
+    std::vector<LocalEntry> firstRun;
+    std::vector<LocalEntry> pending;
+    bool firstRunSent = false;
+    int runSize = countCeiling;
+    QElapsedTimer runTimer;
+    runTimer.start();
+    while (dirIterator->hasNext()) {
+        if (stopFlag)
+            break;
+
+        const auto &fileUrl = dirIterator->next();
+        if (!fileUrl.isValid())
+            continue;
+        // 调用一次fileinfo进行文件缓存
+        auto fileInfo = dirIterator->fileInfo();
+        if (!fileInfo)
+            fileInfo = InfoFactory::create<FileInfo>(fileUrl);
+        if (!fileInfo)
+            continue;
+
+        LocalEntry entry = localEntry(fileInfo);
+        fileList.append(entry.info);
+
+        if (firstRunSent) {
+            pending.push_back(std::move(entry));
+            if (static_cast<int>(pending.size()) >= runSize || runTimer.elapsed() > timeCeiling) {
+                emitRun(pending, false);
+                runSize = qMin(runSize * 2, localRunCeiling);
+                runTimer.restart();
+            }
+            continue;
+        }
+
+        firstRun.push_back(std::move(entry));
+        std::push_heap(firstRun.begin(), firstRun.end(), before);
+        if (static_cast<int>(firstRun.size()) > countCeiling) {
+            std::pop_heap(firstRun.begin(), firstRun.end(), before);
+            pending.push_back(std::move(firstRun.back()));
+            firstRun.pop_back();
+        }
+
+        if (runTimer.elapsed() > firstRunCeiling) {
+            emitRun(firstRun, false);
+            firstRunSent = true;
+            runTimer.restart();
+        }
+    }
+
+    if (stopFlag) {
+        emit traversalFinished(traversalToken);
+        return fileList;
+    }
+
+    // 在首屏时限内遍历完的目录，一次发送
+    std::move(firstRun.begin(), firstRun.end(), std::back_inserter(pending));
+    emitRun(pending, true);
     emit traversalFinished(traversalToken);
 
     return fileList;
 }
 
-void TraversalDirThreadManager::createFileInfo(const QList<SortInfoPointer> &list)
+TraversalDirThreadManager::LocalEntry TraversalDirThreadManager::localEntry(const FileInfoPointer &info) const
 {
-    for (const SortInfoPointer &sortInfo : list) {
-        const QUrl &url = sortInfo->fileUrl();
-        InfoFactory::create<FileInfo>(url);
+    LocalEntry entry;
+    auto sortInfo = SortInfoPointer::create();
+    sortInfo->setUrl(info->urlOf(UrlInfoType::kUrl));
+    sortInfo->setSize(info->size());
+    sortInfo->setFile(!info->isAttributes(OptInfoType::kIsDir));
+    sortInfo->setDir(info->isAttributes(OptInfoType::kIsDir));
+    sortInfo->setHide(info->isAttributes(OptInfoType::kIsHidden));
+    sortInfo->setSymlink(info->isAttributes(OptInfoType::kIsSymLink));
+    sortInfo->setReadable(info->isAttributes(OptInfoType::kIsReadable));
+    sortInfo->setWriteable(info->isAttributes(OptInfoType::kIsWritable));
+    sortInfo->setExecutable(info->isAttributes(OptInfoType::kIsExecutable));
+    entry.info = sortInfo;
+    entry.name = info->displayOf(DisPlayInfoType::kFileDisplayName);
+
+    switch (sortRole) {
+    case dfmio::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileSize:
+        entry.value = sortInfo->isDir() ? 0 : info->size();
+        break;
+    case dfmio::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileLastModified:
+        entry.value = info->timeOf(TimeInfoType::kLastModified).value<QDateTime>().toMSecsSinceEpoch();
+        break;
+    case dfmio::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileLastRead:
+        entry.value = info->timeOf(TimeInfoType::kLastRead).value<QDateTime>().toMSecsSinceEpoch();
+        break;
+    default:
+        break;
     }
+
+    return entry;
 }
@@ -30,6 +30,11 @@ class TraversalDirThreadManager : public TraversalDirThread
     QElapsedTimer *timer = Q_NULLPTR;
     int timeCeiling = 1500;
     int countCeiling = 500;
+    // local children are enumerated one by one: the best countCeiling of what
+    // arrives within firstRunCeiling go out sorted as the first run, the rest
+    // follows in sorted runs growing from countCeiling, which the model merges.
+    int firstRunCeiling = 200;
+    int localRunCeiling = 64000;
     dfmio::DEnumeratorFuture *future { nullptr };
     QString traversalToken;
     std::atomic_bool running = false;
@@ -56,7 +61,8 @@ Q_SIGNALS:
     void updateLocalChildren(const QList<SortInfoPointer> children,
                              dfmio::DEnumerator::SortRoleCompareFlag sortRole,
                              Qt::SortOrder sortOrder,
-                             bool isMixDirAndFile, QString traversalToken);
+                             bool isMixDirAndFile, QString traversalToken,
+                             bool isFinished);
     void traversalFinished(QString traversalToken);
     void traversalRequestSort(QString traversalToken);
 
@@ -66,9 +72,16 @@ protected:
     virtual void run() override;
 
 private:
+    struct LocalEntry
+    {
+        SortInfoPointer info;
+        QString name;
+        qint64 value { 0 };   // size or time of the sort role
+    };
+
     int iteratorOneByOne(const QElapsedTimer &timere);
     QList<SortInfoPointer> iteratorAll();
-    void createFileInfo(const QList<SortInfoPointer> &list);
+    LocalEntry localEntry(const FileInfoPointer &info) const;
 };
 }
 
@@ -392,8 +392,8 @@ QString IconItemDelegate::displayFileName(const QModelIndex &index) const
 
 QList<QRectF> IconItemDelegate::calFileNameRect(const QString &name, const QRectF &rect, Qt::TextElideMode elideMode) const
 {
-    QScopedPointer<ElideTextLayout> layout(ItemDelegateHelper::createTextLayout(name, QTextOption::WrapAtWordBoundaryOrAnywhere,
-                                                                                d->textLineHeight, Qt::AlignCenter));
+    ElideTextLayout *layout = d->textLayout(name, QTextOption::WrapAtWordBoundaryOrAnywhere,
+                                            d->textLineHeight, Qt::AlignCenter);
     return layout->layout(rect, elideMode);
 }
 
@@ -600,13 +600,13 @@ void IconItemDelegate::paintItemFileName(QPainter *painter, QRectF iconRect, QPa
     auto background = isDragMode || (!singleSelected && isSelectedOpt)
             ? (opt.palette.brush(QPalette::Normal, QPalette::Highlight))
             : QBrush(Qt::NoBrush);
-    QScopedPointer<ElideTextLayout> layout(ItemDelegateHelper::createTextLayout(displayName, QTextOption::WrapAtWordBoundaryOrAnywhere,
-                                                                                d->textLineHeight, Qt::AlignCenter, painter));
+    ElideTextLayout *layout = d->textLayout(displayName, QTextOption::WrapAtWordBoundaryOrAnywhere,
+                                            d->textLineHeight, Qt::AlignCenter, painter);
 
     labelRect.setLeft(labelRect.left() + kIconModeRectRadius);
     labelRect.setWidth(labelRect.width() - kIconModeRectRadius);
     const FileInfoPointer &info = parent()->fileInfo(index);
-    WorkspaceEventSequence::instance()->doIconItemLayoutText(info, layout.data());
+    WorkspaceEventSequence::instance()->doIconItemLayoutText(info, layout);
     if (!singleSelected && isSelectedOpt) {
         layout->setAttribute(ElideTextLayout::kBackgroundRadius, kIconModeRectRadius);
     }
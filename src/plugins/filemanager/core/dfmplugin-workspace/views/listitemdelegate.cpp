@@ -480,10 +480,10 @@ void ListItemDelegate::paintItemColumn(QPainter *painter, const QStyleOptionView
                 painter->setPen(opt.palette.color(cGroup, QPalette::Text));
 
             if (data.canConvert<QString>()) {
-                QScopedPointer<ElideTextLayout> layout(ItemDelegateHelper::createTextLayout(index.data(rol).toString().remove('\n'),
-                                                                                            QTextOption::WrapAtWordBoundaryOrAnywhere,
-                                                                                            d->textLineHeight, index.data(Qt::TextAlignmentRole).toInt(),
-                                                                                            painter));
+                ElideTextLayout *layout = d->textLayout(index.data(rol).toString().remove('\n'),
+                                                        QTextOption::WrapAtWordBoundaryOrAnywhere,
+                                                        d->textLineHeight, index.data(Qt::TextAlignmentRole).toInt(),
+                                                        painter);
                 layout->layout(textRect, elideMode, painter);
             }
         }
@@ -497,9 +497,9 @@ void ListItemDelegate::paintFileName(QPainter *painter, const QStyleOptionViewIt
     const QVariant &data = index.data(role);
     painter->setPen(option.palette.color(drawBackground ? QPalette::BrightText : QPalette::Text));
 
-    QScopedPointer<ElideTextLayout> layout(ItemDelegateHelper::createTextLayout("", QTextOption::WrapAtWordBoundaryOrAnywhere,
-                                                                                textLineHeight, index.data(Qt::TextAlignmentRole).toInt(),
-                                                                                painter));
+    ElideTextLayout *layout = d->textLayout("", QTextOption::WrapAtWordBoundaryOrAnywhere,
+                                            textLineHeight, index.data(Qt::TextAlignmentRole).toInt(),
+                                            painter);
 
     if (data.canConvert<QString>()) {
         QString fileName {};
@@ -542,10 +542,8 @@ void ListItemDelegate::paintFileName(QPainter *painter, const QStyleOptionViewIt
 
             fileName = fileName = textList.join('\n');
         }
-        QScopedPointer<ElideTextLayout> layout(ItemDelegateHelper::createTextLayout(fileName,
-                                                                                    QTextOption::WrapAtWordBoundaryOrAnywhere,
-                                                                                    textLineHeight, index.data(Qt::TextAlignmentRole).toInt(),
-                                                                                    painter));
+        layout = d->textLayout(fileName, QTextOption::WrapAtWordBoundaryOrAnywhere,
+                               textLineHeight, index.data(Qt::TextAlignmentRole).toInt(), painter);
         layout->layout(rect, Qt::ElideRight, painter);
     } else {
         // Todo(yanghao&liuyangming)???
@@ -6,6 +6,7 @@
 #include "views/baseitemdelegate.h"
 #include "views/fileview.h"
 #include "utils/fileviewhelper.h"
+#include "utils/itemdelegatehelper.h"
 
 #include <QPainter>
 #include <QAbstractItemView>
@@ -29,3 +30,15 @@ void BaseItemDelegatePrivate::init()
     q->connect(q, &BaseItemDelegate::commitData, q->parent(), &FileViewHelper::handleCommitData);
     q->connect(q->parent()->parent(), &QAbstractItemView::iconSizeChanged, q, &BaseItemDelegate::updateItemSizeHint);
 }
+
+ElideTextLayout *BaseItemDelegatePrivate::textLayout(const QString &name, QTextOption::WrapMode wordWrap,
+                                                     qreal lineHeight, int alignmentFlag, QPainter *painter) const
+{
+    if (layout.isNull()) {
+        layout.reset(new ElideTextLayout);
+        layout->setLayoutCache(&layoutCache);
+    }
+
+    ItemDelegateHelper::initTextLayout(layout.data(), name, wordWrap, lineHeight, alignmentFlag, painter);
+    return layout.data();
+}
@@ -8,13 +8,17 @@
 #include "dfmplugin_workspace_global.h"
 
 #include <dfm-base/utils/elidetextlayout.h>
+#include <dfm-base/utils/elidetextlayoutcache.h>
 
 #include <QModelIndex>
+#include <QScopedPointer>
+#include <QTextOption>
 #include <QSize>
 #include <QtGlobal>
 
 QT_BEGIN_NAMESPACE
 class QLineEdit;
+class QPainter;
 QT_END_NAMESPACE
 
 namespace dfmplugin_workspace {
@@ -29,11 +33,16 @@ public:
     virtual ~BaseItemDelegatePrivate();
 
     void init();
+    // the layout is reused by every paint, it is valid until the next call.
+    dfmbase::ElideTextLayout *textLayout(const QString &name, QTextOption::WrapMode wordWrap,
+                                         qreal lineHeight, int alignmentFlag, QPainter *painter = nullptr) const;
 
     int textLineHeight { -1 };
     QSize itemSizeHint;
     mutable QModelIndex editingIndex;
     mutable QLineEdit *editor = nullptr;
+    mutable dfmbase::ElideTextLayoutCache layoutCache;
+    mutable QScopedPointer<dfmbase::ElideTextLayout> layout;
 
     AbstractItemPaintProxy *paintProxy { nullptr };
 
@@ -61,7 +61,7 @@ bool AnythingSearcher::search()
 
     uint32_t startOffset = 0;
     uint32_t endOffset = 0;
-    QHash<QString, QSet<QString>> hiddenFileHash;
+    HiddenFilters hiddenFileHash;
     while (!searchDirList.isEmpty()) {
         //中断
         if (status.loadAcquire() != kRuning)
@@ -6,6 +6,7 @@
 #define FSEARCHER_H
 
 #include "searchmanager/searcher/abstractsearcher.h"
+#include "utils/searchhelper.h"
 
 #include <QElapsedTimer>
 #include <QMutex>
@@ -39,7 +40,7 @@ private:
     mutable QMutex mutex;
     QWaitCondition waitCondition;
     QMutex conditionMtx;
-    QHash<QString, QSet<QString>> hiddenFileHash;
+    HiddenFilters hiddenFileHash;
 
     //计时
     QElapsedTimer notifyTimer;
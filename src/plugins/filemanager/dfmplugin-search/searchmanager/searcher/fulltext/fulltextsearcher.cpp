@@ -344,7 +344,7 @@ bool FullTextSearcherPrivate::doSearch(const QString &path, const QString &keywo
         TopDocsPtr topDocs = searcher->search(query, filter, kMaxResultNum);
         Collection<ScoreDocPtr> scoreDocs = topDocs->scoreDocs;
 
-        QHash<QString, QSet<QString>> hiddenFileHash;
+        HiddenFilters hiddenFileHash;
         for (auto scoreDoc : scoreDocs) {
             //中断
             if (status.loadAcquire() != AbstractSearcher::kRuning)
@@ -7,6 +7,7 @@
 
 #include <dfm-base/interfaces/fileinfo.h>
 #include <dfm-base/base/schemefactory.h>
+#include <dfm-base/utils/hidefilehelper.h>
 
 #include <dfm-framework/dpf.h>
 
@@ -272,46 +273,43 @@ QString SearchHelper::wildcardToRegularExpression(const QString &pattern)
     return anchoredPattern(rx);
 }
 
-bool SearchHelper::isHiddenFile(const QString &fileName, QHash<QString, QSet<QString>> &filters, const QString &searchPath)
+bool SearchHelper::isHiddenFile(const QString &fileName, HiddenFilters &filters, const QString &searchPath)
 {
     if (!fileName.startsWith(searchPath) || fileName == searchPath)
         return false;
 
-    QFileInfo fileInfo(fileName);
-    if (fileInfo.isHidden())
+    // the states of directories are only valid in the same search path.
+    if (filters.searchPath != searchPath) {
+        filters.searchPath = searchPath;
+        filters.hiddenDirs.clear();
+    }
+
+    QString filePath = fileName;
+    while (filePath.size() > 1 && filePath.endsWith('/'))
+        filePath.chop(1);
+
+    const int sep = filePath.lastIndexOf('/');
+    if (filePath.midRef(sep + 1).startsWith('.'))
         return true;
 
-    const auto &fileParentPath = fileInfo.absolutePath();
-    const auto &hiddenFileConfig = fileParentPath + "/.hidden";
+    const QString &fileParentPath = sep > 0 ? filePath.left(sep) : QString("/");
 
-    // 判断.hidden文件是否存在，不存在说明该路径下没有隐藏文件
-    if (!QFile::exists(hiddenFileConfig))
-        return isHiddenFile(fileParentPath, filters, searchPath);
+    // 每个目录的.hidden文件在一次搜索中只读取一次，没有.hidden文件的目录记录为空
+    auto it = filters.hideLists.find(fileParentPath);
+    if (it == filters.hideLists.end())
+        it = filters.hideLists.insert(fileParentPath, HideFileHelper::hideListOf(fileParentPath));
 
-    if (filters[fileParentPath].isEmpty()) {
-        QFile file(hiddenFileConfig);
-        // 判断.hidden文件中的内容是否为空，空则表示该路径下没有隐藏文件
-        if (file.isReadable() && file.size() > 0) {
-            if (!file.open(QFile::ReadOnly))
-                return false;
+    if (it->contains(filePath.mid(sep + 1)))
+        return true;
 
-            QByteArray data = file.readAll();
-            file.close();
-#if (QT_VERSION <= QT_VERSION_CHECK(5, 15, 0))
-            const auto &hiddenFiles = QSet<QString>::fromList(QString(data).split('\n', QString::SkipEmptyParts));
-#else
-            auto &&list { QString(data).split('\n', Qt::SkipEmptyParts) };
-            const auto &hiddenFiles = QSet<QString>(list.begin(), list.end());
-#endif
-            filters[fileParentPath] = hiddenFiles;
-        } else {
-            return isHiddenFile(fileParentPath, filters, searchPath);
-        }
-    }
+    // 父目录的结果在一次搜索中只计算一次
+    auto dir = filters.hiddenDirs.constFind(fileParentPath);
+    if (dir != filters.hiddenDirs.constEnd())
+        return dir.value();
 
-    return filters[fileParentPath].contains(fileInfo.fileName())
-            ? true
-            : isHiddenFile(fileParentPath, filters, searchPath);
+    const bool hidden = isHiddenFile(fileParentPath, filters, searchPath);
+    filters.hiddenDirs.insert(fileParentPath, hidden);
+    return hidden;
 }
 
 QDBusInterface &SearchHelper::anythingInterface()
@@ -12,9 +12,21 @@
 #include <QUrl>
 #include <QWidget>
 #include <QDBusInterface>
+#include <QHash>
+#include <QSet>
 
 namespace dfmplugin_search {
 
+// the hidden states found in a search task.
+struct HiddenFilters
+{
+    QString searchPath;
+    // the names in .hidden file of directories.
+    QHash<QString, QSet<QString>> hideLists;
+    // whether the directory is hidden or in a hidden directory under the search path.
+    QHash<QString, bool> hiddenDirs;
+};
+
 class SearchHelper final : public QObject
 {
     Q_OBJECT
@@ -59,7 +71,7 @@ public:
                 + expression
                 + QLatin1String(")\\z");
     }
-    bool isHiddenFile(const QString &fileName, QHash<QString, QSet<QString>> &filters, const QString &searchPath);
+    bool isHiddenFile(const QString &fileName, HiddenFilters &filters, const QString &searchPath);
 
     static QDBusInterface &anythingInterface();
 private:
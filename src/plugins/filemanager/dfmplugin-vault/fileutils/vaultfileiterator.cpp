@@ -9,6 +9,7 @@
 
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/file/local/asyncfileinfo.h>
+#include <dfm-base/utils/hidefilehelper.h>
 
 #include <dfm-io/denumerator.h>
 #include <dfm-io/dfmio_utils.h>
@@ -29,8 +30,7 @@ VaultFileIterator::VaultFileIterator(const QUrl &url, const QStringList &nameFil
     if (!dfmioDirIterator)
         fmCritical("Vault: create DEnumerator failed!");
 
-    const QUrl &hidUrl = DFMIO::DFMUtils::buildFilePath(localUrl.toString().toStdString().c_str(), ".hidden", nullptr);
-    hideFileList = DFMIO::DFMUtils::hideListFromUrl(hidUrl);
+    hideFileList = HideFileHelper::hideListOf(localUrl.toLocalFile());
 }
 
 VaultFileIterator::~VaultFileIterator()
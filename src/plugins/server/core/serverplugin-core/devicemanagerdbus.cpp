@@ -5,6 +5,7 @@
 #include "devicemanagerdbus.h"
 #include "serverplugin_core_global.h"
 
+#include <dfm-base/base/device/deviceutils.h>
 #include <dfm-base/utils/universalutils.h>
 #include <dfm-base/base/standardpaths.h>
 #include <dfm-base/dbusservice/global_server_defines.h>
@@ -56,6 +57,9 @@ void DeviceManagerDBus::initialize()
  */
 void DeviceManagerDBus::initConnection()
 {
+    // before the other signals, so that clients have updated their mirror when they are notified.
+    initSnapshotConnection();
+
     connect(DevMngIns, &DeviceManager::blockDevUnmountAsyncFailed, this, [this](auto deviceId) {
         emit NotifyDeviceBusy(deviceId, DeviceBusyAction::kUnmount);
     });
@@ -107,6 +111,47 @@ void DeviceManagerDBus::initConnection()
     });
 }
 
+/*!
+ * \brief every change of a device bumps the snapshot version and publishes the new properties of the device,
+ * an empty property map means the device is removed.
+ * size changes are not included, they are published by SizeUsedChanged.
+ */
+void DeviceManagerDBus::initSnapshotConnection()
+{
+    auto update = [this](const QString &id) { notifySnapshotChanged(id); };
+    auto remove = [this](const QString &id) { notifySnapshotChanged(id, true); };
+
+    connect(DevMngIns, &DeviceManager::blockDevAdded, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevRemoved, this, remove);
+    connect(DevMngIns, &DeviceManager::blockDevFsAdded, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevFsRemoved, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevMounted, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevUnmounted, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevLocked, this, update);
+    connect(DevMngIns, &DeviceManager::blockDevUnlocked, this, [this](const QString &id, const QString &clearDeviceId) {
+        notifySnapshotChanged(id);
+        notifySnapshotChanged(clearDeviceId);
+    });
+    connect(DevMngIns, &DeviceManager::blockDevPropertyChanged, this, update);
+
+    connect(DevMngIns, &DeviceManager::protocolDevAdded, this, update);
+    connect(DevMngIns, &DeviceManager::protocolDevRemoved, this, remove);
+    connect(DevMngIns, &DeviceManager::protocolDevMounted, this, update);
+    connect(DevMngIns, &DeviceManager::protocolDevUnmounted, this, update);
+}
+
+void DeviceManagerDBus::notifySnapshotChanged(const QString &id, bool removed)
+{
+    if (id.isEmpty())
+        return;
+
+    QVariantMap info;
+    if (!removed)
+        info = id.startsWith(kBlockDeviceIdPrefix) ? DevMngIns->getBlockDevInfo(id)
+                                                   : DevMngIns->getProtocolDevInfo(id);
+    emit DeviceSnapshotChanged(++snapshotVersion, id, info);
+}
+
 void DeviceManagerDBus::requestRefreshDesktopAsNeeded(const QString &path, const QString &operation)
 {
     QString desktopPath = StandardPaths::location(StandardPaths::kDesktopPath);
@@ -167,3 +212,23 @@ QVariantMap DeviceManagerDBus::QueryProtocolDeviceInfo(QString id, bool reload)
 {
     return DevMngIns->getProtocolDevInfo(id, reload);
 }
+
+/*!
+ * \brief all the block and protocol devices with their properties in one call,
+ * the version can be matched with the one of DeviceSnapshotChanged.
+ * \return see GlobalServerDefines::DeviceSnapshot
+ */
+QVariantMap DeviceManagerDBus::QueryDevicesSnapshot()
+{
+    QVariantMap blocks;
+    for (const auto &id : DevMngIns->getAllBlockDevID())
+        blocks.insert(id, DevMngIns->getBlockDevInfo(id));
+
+    QVariantMap protocols;
+    for (const auto &id : DevMngIns->getAllProtocolDevID())
+        protocols.insert(id, DevMngIns->getProtocolDevInfo(id));
+
+    return { { DeviceSnapshot::kVersion, snapshotVersion },
+             { DeviceSnapshot::kBlockDevices, blocks },
+             { DeviceSnapshot::kProtocolDevices, protocols } };
+}
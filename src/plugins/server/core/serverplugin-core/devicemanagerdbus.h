@@ -40,6 +40,8 @@ signals:
     void ProtocolDeviceMounted(QString id, QString mountPoint);
     void ProtocolDeviceUnmounted(QString id, const QString &oldMpt);
 
+    void DeviceSnapshotChanged(qulonglong version, QString id, QVariantMap info);
+
 public slots:
     bool IsMonotorWorking();
     void DetachBlockDevice(QString id);
@@ -50,11 +52,17 @@ public slots:
     QVariantMap QueryBlockDeviceInfo(QString id, bool reload);
     QStringList GetProtocolDevicesIdList();
     QVariantMap QueryProtocolDeviceInfo(QString id, bool reload);
+    QVariantMap QueryDevicesSnapshot();
 
 private:
     void initialize();
     void initConnection();
+    void initSnapshotConnection();
+    void notifySnapshotChanged(const QString &id, bool removed = false);
     void requestRefreshDesktopAsNeeded(const QString &path, const QString &operation);
+
+private:
+    qulonglong snapshotVersion { 0 };
 };
 
 #endif   // DEVICEMANAGERDBUS_H
@@ -26,6 +26,17 @@ SERVERTAGDAEMON_BEGIN_NAMESPACE
 
 static constexpr char kTagTableFileTags[] = "file_tags";
 static constexpr char kTagTableTagProperty[] = "tag_property";
+// SQLite builds before 3.32 limit host parameters to 999 per statement
+static constexpr int kMaxBindsPerStatement = 999;
+
+static QString makePlaceholders(int rows, int columns)
+{
+    QString row { "?" };
+    if (columns > 1)
+        row = "(" + row + QString(",?").repeated(columns - 1) + ")";
+
+    return row + QString("," + row).repeated(rows - 1);
+}
 
 TagDbHandler *TagDbHandler::instance()
 {
@@ -60,12 +71,10 @@ QVariantMap TagDbHandler::getTagsColor(const QStringList &tags)
     }
 
     // query
-    const auto &field = Expression::Field<TagProperty>;
     QVariantMap tagColorsMap;
     for (auto &tag : tags) {
-        const auto &beanList = handle->query<TagProperty>().where(field("tagName") == tag).toBeans();
-        const auto &color = beanList.isEmpty() ? "" : beanList.first()->getTagColor();
-        if (!color.isEmpty())
+        QString color;
+        if (queryTagColor(tag, &color) && !color.isEmpty())
             tagColorsMap.insert(tag, QVariant { QVariant { color } });
     }
 
@@ -82,18 +91,13 @@ QVariantMap TagDbHandler::getTagsByUrls(const QStringList &urlList)
     }
 
     // query
-    const auto &field = Expression::Field<FileTagInfo>;
-    QVariantMap allFileTags;
-    for (auto &path : urlList) {
-        const auto &beanList = handle->query<FileTagInfo>().where(field("filePath") == path).toBeans();
-
-        QStringList fileTags;
-        for (auto oneBean : beanList)
-            fileTags.append(oneBean->getTagName());
+    QHash<QString, QStringList> fileTags;
+    if (!queryTagsOfFiles(urlList, &fileTags))
+        return {};
 
-        if (!fileTags.isEmpty())
-            allFileTags.insert(path, fileTags);
-    }
+    QVariantMap allFileTags;
+    for (auto it = fileTags.cbegin(); it != fileTags.cend(); ++it)
+        allFileTags.insert(it.key(), it.value());
 
     finally.dismiss();
     return allFileTags;
@@ -139,16 +143,13 @@ QVariantMap TagDbHandler::getFilesByTag(const QStringList &tags)
     }
 
     // query
-    const auto &field = Expression::Field<FileTagInfo>;
-    QVariantMap allTagFiles;
-    for (auto &tag : tags) {
-        const auto &obj = handle->query<FileTagInfo>().where(field("tagName") == tag).toBeans();
-        QStringList files;
-        for (auto tempBean : obj)
-            files.append(tempBean->getFilePath());
+    QHash<QString, QStringList> tagFiles;
+    if (!queryFilesOfTags(tags, &tagFiles))
+        return {};
 
-        allTagFiles.insert(tag, QVariant { files });
-    }
+    QVariantMap allTagFiles;
+    for (auto &tag : tags)
+        allTagFiles.insert(tag, QVariant { tagFiles.value(tag) });
 
     finally.dismiss();
     return allTagFiles;
@@ -226,14 +227,16 @@ bool TagDbHandler::addTagsForFiles(const QVariantMap &data)
         }
     }
 
+    QList<QPair<QString, QString>> fileTags;
+    for (auto dataIt = tmpData.begin(); dataIt != tmpData.end(); ++dataIt) {
+        const QStringList &tags = dataIt.value().toStringList();
+        for (const auto &tag : tags)
+            fileTags.append({ dataIt.key(), tag });
+    }
+
     // insert file--tags
-    bool ret = handle->transaction([tmpData, this]() -> bool {
-        for (auto dataIt = tmpData.begin(); dataIt != tmpData.end(); ++dataIt) {
-            bool ret = tagFile(dataIt.key(), dataIt.value());
-            if (!ret)
-                return ret;
-        }
-        return true;
+    bool ret = handle->transaction([&fileTags, this]() -> bool {
+        return insertFileTags(fileTags);
     });
 
     emit filesWereTagged(data);
@@ -300,11 +303,11 @@ bool TagDbHandler::deleteFiles(const QStringList &urls)
         return false;
     }
 
-    auto field = Expression::Field<FileTagInfo>;
-    for (const auto &url : urls) {
-        if (!handle->remove<FileTagInfo>(field("filePath") == url))
-            return false;
-    }
+    bool ret = handle->transaction([&urls, this]() -> bool {
+        return removeFilesByPath(urls);
+    });
+    if (!ret)
+        return false;
 
     finally.dismiss();
     return true;
@@ -404,6 +407,7 @@ void TagDbHandler::initialize()
     const auto &dbFilePath = DFMUtils::buildFilePath(dbPath.toLocal8Bit(),
                                                      Global::DataBase::kDfmDBName,
                                                      nullptr);
+    this->dbFilePath = dbFilePath;
     handle.reset(new SqliteHandle(dbFilePath));
     QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
     if (!db.isValid() || db.isOpenError()) {
@@ -417,6 +421,11 @@ void TagDbHandler::initialize()
 
     if (!createTable(kTagTableTagProperty))
         fmWarning() << "Create table failed:" << kTagTableFileTags;
+
+    if (!createIndexes())
+        fmWarning() << "Create index failed:" << kTagTableFileTags;
+
+    enableWriteAheadLog();
 }
 
 bool TagDbHandler::createTable(const QString &tableName)
@@ -443,59 +452,55 @@ bool TagDbHandler::createTable(const QString &tableName)
 
 bool TagDbHandler::checkTag(const QString &tag)
 {
-    return handle->query<TagProperty>().where(Expression::Field<TagProperty>("tagName") == tag).toBeans().size() > 0;
+    return queryTagColor(tag, nullptr);
 }
 
-bool TagDbHandler::insertTagProperty(const QString &name, const QVariant &value)
+bool TagDbHandler::queryTagColor(const QString &tag, QString *color)
 {
-    DFMBASE_NAMESPACE::FinallyUtil finally([&]() { lastErr.clear(); });
-
-    if (name.isEmpty() || value.isNull()) {
-        lastErr = "input parameter is empty!";
+    // called once per tag, reuse the prepared statement instead of building the sql each time
+    QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
+    QSqlQuery query;
+    // the statement stays cached, reset it when done so no read transaction is left open
+    DFMBASE_NAMESPACE::FinallyUtil releaseQuery([&query]() { query.finish(); });
+    const QString &sql = QString("SELECT tagColor FROM %1 WHERE tagName = ? LIMIT 1;").arg(kTagTableTagProperty);
+    if (!SqliteConnectionPool::instance().prepareQuery(db, sql, &query)) {
+        lastErr = query.lastError().text();
         return false;
     }
 
-    // insert TagProperty
-    TagProperty temp;
-    temp.setTagName(name);
-    temp.setTagColor(value.toString());
-    temp.setFuture("null");
-    temp.setAmbiguity(1);
-
-    if (-1 == handle->insert<TagProperty>(temp)) {
-        lastErr = QString("insert TagProperty failed! tagName: %1, tagValue: %2").arg(name).arg(value.toString());
+    query.bindValue(0, tag);
+    if (!query.exec()) {
+        lastErr = query.lastError().text();
+        SqliteConnectionPool::instance().reportError(db, query.lastError());
         return false;
     }
 
-    finally.dismiss();
+    if (!query.next())
+        return false;
+
+    if (color)
+        *color = query.value(0).toString();
     return true;
 }
 
-bool TagDbHandler::tagFile(const QString &file, const QVariant &tags)
+bool TagDbHandler::insertTagProperty(const QString &name, const QVariant &value)
 {
     DFMBASE_NAMESPACE::FinallyUtil finally([&]() { lastErr.clear(); });
 
-    if (file.isEmpty() || tags.isNull()) {
+    if (name.isEmpty() || value.isNull()) {
         lastErr = "input parameter is empty!";
         return false;
     }
 
-    // insert file--tags
-    const QStringList &tempTags = tags.toStringList();
-    int suc = tempTags.count();
-    for (const auto &tag : tempTags) {
-        FileTagInfo temp;
-        temp.setFilePath(file);
-        temp.setTagName(tag);
-        temp.setTagOrder(0);
-        temp.setFuture("null");
-        if (-1 == handle->insert<FileTagInfo>(temp))
-            break;
-        suc--;
-    }
+    // insert TagProperty
+    TagProperty temp;
+    temp.setTagName(name);
+    temp.setTagColor(value.toString());
+    temp.setFuture("null");
+    temp.setAmbiguity(1);
 
-    if (0 < suc) {
-        lastErr = QString("Tag file failed! file: %1, tagName: %2").arg(file).arg(tempTags.at(--suc));
+    if (-1 == handle->insert<TagProperty>(temp)) {
+        lastErr = QString("insert TagProperty failed! tagName: %1, tagValue: %2").arg(name).arg(value.toString());
         return false;
     }
 
@@ -599,4 +604,174 @@ bool TagDbHandler::changeFilePath(const QString &oldPath, const QString &newPath
     return true;
 }
 
+bool TagDbHandler::createIndexes()
+{
+    return handle->excute(QString("CREATE INDEX IF NOT EXISTS idx_%1_filePath ON %1(filePath);").arg(kTagTableFileTags))
+            && handle->excute(QString("CREATE INDEX IF NOT EXISTS idx_%1_tagName ON %1(tagName);").arg(kTagTableFileTags))
+            && handle->excute(QString("CREATE INDEX IF NOT EXISTS idx_%1_tagName ON %1(tagName);").arg(kTagTableTagProperty));
+}
+
+void TagDbHandler::enableWriteAheadLog()
+{
+    // journal mode is persisted in the database file, readers no longer block the writer
+    if (!handle->excute("PRAGMA journal_mode=WAL;")) {
+        fmWarning() << "Enable WAL failed for tag database";
+        return;
+    }
+
+    // with WAL, NORMAL only syncs at checkpoints and stays consistent after a crash,
+    // it is set per connection, so every later connection gets it too
+    SqliteConnectionPool::instance().setConnectionPragmas(dbFilePath, { "synchronous=NORMAL" });
+    if (!handle->excute("PRAGMA synchronous=NORMAL;"))
+        fmWarning() << "Set synchronous failed for tag database";
+}
+
+bool TagDbHandler::queryTagsOfFiles(const QStringList &files, QHash<QString, QStringList> *fileTags)
+{
+    Q_ASSERT(fileTags);
+    QStringList uniqueFiles { files };
+    uniqueFiles.removeDuplicates();
+
+    QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
+    QSqlQuery query;
+    DFMBASE_NAMESPACE::FinallyUtil releaseQuery([&query]() { query.finish(); });
+    int preparedSize { -1 };
+    for (int pos = 0; pos < uniqueFiles.size(); pos += kMaxBindsPerStatement) {
+        const QStringList &chunk = uniqueFiles.mid(pos, kMaxBindsPerStatement);
+        // only the last chunk has a different size, so at most two statements are prepared
+        if (chunk.size() != preparedSize) {
+            const QString &sql = QString("SELECT filePath, tagName FROM %1 WHERE filePath IN (%2) ORDER BY fileIndex;")
+                                         .arg(kTagTableFileTags, makePlaceholders(chunk.size(), 1));
+            if (!SqliteConnectionPool::instance().prepareQuery(db, sql, &query)) {
+                lastErr = query.lastError().text();
+                return false;
+            }
+            preparedSize = chunk.size();
+        }
+
+        for (int i = 0; i < chunk.size(); ++i)
+            query.bindValue(i, chunk.at(i));
+
+        if (!query.exec()) {
+            lastErr = query.lastError().text();
+            SqliteConnectionPool::instance().reportError(db, query.lastError());
+            return false;
+        }
+
+        while (query.next())
+            (*fileTags)[query.value(0).toString()].append(query.value(1).toString());
+    }
+
+    return true;
+}
+
+bool TagDbHandler::queryFilesOfTags(const QStringList &tags, QHash<QString, QStringList> *tagFiles)
+{
+    Q_ASSERT(tagFiles);
+    QStringList uniqueTags { tags };
+    uniqueTags.removeDuplicates();
+
+    QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
+    QSqlQuery query;
+    DFMBASE_NAMESPACE::FinallyUtil releaseQuery([&query]() { query.finish(); });
+    int preparedSize { -1 };
+    for (int pos = 0; pos < uniqueTags.size(); pos += kMaxBindsPerStatement) {
+        const QStringList &chunk = uniqueTags.mid(pos, kMaxBindsPerStatement);
+        if (chunk.size() != preparedSize) {
+            const QString &sql = QString("SELECT tagName, filePath FROM %1 WHERE tagName IN (%2) ORDER BY fileIndex;")
+                                         .arg(kTagTableFileTags, makePlaceholders(chunk.size(), 1));
+            if (!SqliteConnectionPool::instance().prepareQuery(db, sql, &query)) {
+                lastErr = query.lastError().text();
+                return false;
+            }
+            preparedSize = chunk.size();
+        }
+
+        for (int i = 0; i < chunk.size(); ++i)
+            query.bindValue(i, chunk.at(i));
+
+        if (!query.exec()) {
+            lastErr = query.lastError().text();
+            SqliteConnectionPool::instance().reportError(db, query.lastError());
+            return false;
+        }
+
+        while (query.next())
+            (*tagFiles)[query.value(0).toString()].append(query.value(1).toString());
+    }
+
+    return true;
+}
+
+bool TagDbHandler::insertFileTags(const QList<QPair<QString, QString>> &fileTags)
+{
+    // filePath, tagName, tagOrder, future
+    static constexpr int kColumns = 4;
+    static constexpr int kRowsPerStatement = kMaxBindsPerStatement / kColumns;
+
+    QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
+    QSqlQuery query;
+    DFMBASE_NAMESPACE::FinallyUtil releaseQuery([&query]() { query.finish(); });
+    int preparedRows { -1 };
+    for (int pos = 0; pos < fileTags.size(); pos += kRowsPerStatement) {
+        const int rows = qMin(kRowsPerStatement, fileTags.size() - pos);
+        if (rows != preparedRows) {
+            const QString &sql = QString("INSERT INTO %1(filePath,tagName,tagOrder,future) VALUES %2;")
+                                         .arg(kTagTableFileTags, makePlaceholders(rows, kColumns));
+            if (!SqliteConnectionPool::instance().prepareQuery(db, sql, &query)) {
+                lastErr = query.lastError().text();
+                return false;
+            }
+            preparedRows = rows;
+        }
+
+        int bind { 0 };
+        for (int i = pos; i < pos + rows; ++i) {
+            query.bindValue(bind++, fileTags.at(i).first);
+            query.bindValue(bind++, fileTags.at(i).second);
+            query.bindValue(bind++, 0);
+            query.bindValue(bind++, QStringLiteral("null"));
+        }
+
+        if (!query.exec()) {
+            lastErr = QString("Tag file failed! file: %1, error: %2").arg(fileTags.at(pos).first, query.lastError().text());
+            SqliteConnectionPool::instance().reportError(db, query.lastError());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TagDbHandler::removeFilesByPath(const QStringList &files)
+{
+    QSqlDatabase db { SqliteConnectionPool::instance().openConnection(dbFilePath) };
+    QSqlQuery query;
+    DFMBASE_NAMESPACE::FinallyUtil releaseQuery([&query]() { query.finish(); });
+    int preparedSize { -1 };
+    for (int pos = 0; pos < files.size(); pos += kMaxBindsPerStatement) {
+        const QStringList &chunk = files.mid(pos, kMaxBindsPerStatement);
+        if (chunk.size() != preparedSize) {
+            const QString &sql = QString("DELETE FROM %1 WHERE filePath IN (%2);")
+                                         .arg(kTagTableFileTags, makePlaceholders(chunk.size(), 1));
+            if (!SqliteConnectionPool::instance().prepareQuery(db, sql, &query)) {
+                lastErr = query.lastError().text();
+                return false;
+            }
+            preparedSize = chunk.size();
+        }
+
+        for (int i = 0; i < chunk.size(); ++i)
+            query.bindValue(i, chunk.at(i));
+
+        if (!query.exec()) {
+            lastErr = query.lastError().text();
+            SqliteConnectionPool::instance().reportError(db, query.lastError());
+            return false;
+        }
+    }
+
+    return true;
+}
+
 SERVERTAGDAEMON_END_NAMESPACE
@@ -62,13 +62,21 @@ private:
     void initialize();
     bool createTable(const QString &tableName);
     bool checkTag(const QString &tag);
+    bool queryTagColor(const QString &tag, QString *color);
     bool insertTagProperty(const QString &name, const QVariant &value);
-    bool tagFile(const QString &file, const QVariant &tags);
     bool removeSpecifiedTagOfFile(const QString &url, const QVariant &val);
     bool changeTagColor(const QString &tagName, const QString &newTagColor);
     bool changeTagNameWithFile(const QString &tagName, const QString &newName);
     bool changeFilePath(const QString &oldPath, const QString &newPath);
 
+    // batched sql, all statements are prepared and bound
+    bool createIndexes();
+    void enableWriteAheadLog();
+    bool queryTagsOfFiles(const QStringList &files, QHash<QString, QStringList> *fileTags);
+    bool queryFilesOfTags(const QStringList &tags, QHash<QString, QStringList> *tagFiles);
+    bool insertFileTags(const QList<QPair<QString, QString>> &fileTags);
+    bool removeFilesByPath(const QStringList &files);
+
 Q_SIGNALS:
     void newTagsAdded(const QVariantMap &newTags);
     void tagsDeleted(const QStringList &beDeletedTags);
@@ -79,6 +87,7 @@ Q_SIGNALS:
 
 private:
     QScopedPointer<DFMBASE_NAMESPACE::SqliteHandle> handle;
+    QString dbFilePath;
     QString lastErr;
 };
 
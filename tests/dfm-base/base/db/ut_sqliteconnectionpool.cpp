@@ -7,6 +7,8 @@
 #include <dfm-base/base/db/private/sqliteconnectionpool_p.h>
 
 #include <QCryptographicHash>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
 #include <QtConcurrent>
 
 #include <gtest/gtest.h>
@@ -116,3 +118,104 @@ TEST_F(UT_SqliteConnectionPool, openConnection_Contains)
     QSqlDatabase::removeDatabase(fullConnectionName);
     stub.clear();
 }
+
+TEST_F(UT_SqliteConnectionPool, prepareQuery)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString &dbPath = dir.filePath("test.db");
+    auto &pool = SqliteConnectionPool::instance();
+    pool.setConnectionPragmas(dbPath, { "synchronous=NORMAL" });
+
+    QSqlDatabase db = pool.openConnection(dbPath);
+    ASSERT_TRUE(db.isOpen());
+    const QString connName = db.connectionName();
+    {
+        QSqlQuery query(db);
+        EXPECT_TRUE(query.exec("PRAGMA synchronous;") && query.next());
+        EXPECT_EQ(query.value(0).toInt(), 1);
+        EXPECT_TRUE(query.exec("CREATE TABLE tags(name TEXT, color TEXT);"));
+    }
+
+    {
+        const QString sql { "SELECT color FROM tags WHERE name = ?;" };
+        QSqlQuery first, second;
+        EXPECT_TRUE(pool.prepareQuery(db, sql, &first));
+        EXPECT_TRUE(pool.prepareQuery(db, sql, &second));
+        EXPECT_EQ(first.result(), second.result());
+
+        // the least recently used statement is evicted
+        QSqlQuery other;
+        for (int i = 0; i < SqliteConnectionPoolPrivate::kMaxCachedStatements; ++i)
+            EXPECT_TRUE(pool.prepareQuery(db, QString("SELECT %1 FROM tags;").arg(i), &other));
+        EXPECT_TRUE(pool.prepareQuery(db, sql, &second));
+        EXPECT_NE(first.result(), second.result());
+
+        QSqlQuery bad;
+        EXPECT_FALSE(pool.prepareQuery(db, "SELECT FROM", &bad));
+        EXPECT_TRUE(bad.lastError().isValid());
+    }
+
+    // a closed connection is reopened on the next borrow, a healthy one survives an error report
+    db.close();
+    db = pool.openConnection(dbPath);
+    EXPECT_TRUE(db.isOpen());
+    // the statements of the closed connection are not reused
+    EXPECT_FALSE(pool.d->statements.contains(connName));
+    pool.reportError(db, QSqlError("driver", "database", QSqlError::StatementError));
+    EXPECT_TRUE(db.isOpen());
+
+    pool.d->dropStatements(connName);
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(connName);
+}
+
+TEST_F(UT_SqliteConnectionPool, prepareQuery_Lookups)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString &dbPath = dir.filePath("tags.db");
+    auto &pool = SqliteConnectionPool::instance();
+    QSqlDatabase db = pool.openConnection(dbPath);
+    ASSERT_TRUE(db.isOpen());
+    const QString connName = db.connectionName();
+
+    {
+        QSqlQuery query(db);
+        EXPECT_TRUE(query.exec("CREATE TABLE tags(name TEXT, color TEXT);"));
+        EXPECT_TRUE(query.exec("CREATE INDEX idx_tags_name ON tags(name);"));
+        for (int i = 0; i < 100; ++i)
+            EXPECT_TRUE(query.exec(QString("INSERT INTO tags VALUES('tag%1', 'red');").arg(i)));
+    }
+
+    const QString sql { "SELECT color FROM tags WHERE name = ? LIMIT 1;" };
+    const int lookups = 100000;
+    auto lookup = [&](bool cached) {
+        int found = 0;
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < lookups; ++i) {
+            QSqlQuery query;
+            db = pool.openConnection(dbPath);
+            if (cached) {
+                pool.prepareQuery(db, sql, &query);
+            } else {
+                query = QSqlQuery(db);
+                query.prepare(sql);
+            }
+            query.bindValue(0, QString("tag%1").arg(i % 200));
+            if (query.exec() && query.next())
+                ++found;
+        }
+        qInfo() << lookups << "tag lookups," << (cached ? "cached statements:" : "prepared each time:")
+                << timer.elapsed() << "ms";
+        return found;
+    };
+
+    EXPECT_EQ(lookup(false), lookups / 2);
+    EXPECT_EQ(lookup(true), lookups / 2);
+
+    pool.d->dropStatements(connName);
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(connName);
+}
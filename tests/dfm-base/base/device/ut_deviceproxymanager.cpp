@@ -277,3 +277,48 @@ TEST_F(UT_DeviceProxyManagerPrivate, RemoveMounts)
     EXPECT_NO_FATAL_FAILURE(DevProxyMng->d->removeMounts(""));
     EXPECT_NO_FATAL_FAILURE(DevProxyMng->d->removeMounts("1234"));
 }
+
+TEST_F(UT_DeviceProxyManagerPrivate, SnapshotMirror)
+{
+    auto d = DevProxyMng->d.data();
+    const QString sdb1 { "/org/freedesktop/UDisks2/block_devices/sdb1" };
+    const QString sdc1 { "/org/freedesktop/UDisks2/block_devices/sdc1" };
+    const QString smb { "smb://1.2.3.4/share/" };
+
+    d->resetMirror();
+    d->blockMirror.insert(sdb1, { { "Id", sdb1 } });
+    d->mirrorVersion = 3;
+    d->mirrorReady = true;
+
+    QVariantMap info;
+    EXPECT_TRUE(d->mirrorInfo(sdb1, &info, false));
+    EXPECT_FALSE(d->mirrorInfo(sdc1, &info, false));
+
+    // old and next changes
+    d->onSnapshotChanged(3, sdc1, { { "Id", sdc1 } });
+    EXPECT_FALSE(d->mirrorInfo(sdc1, &info, false));
+    d->onSnapshotChanged(4, sdc1, { { "Id", sdc1 } });
+    EXPECT_TRUE(d->mirrorInfo(sdc1, &info, false));
+    d->onSnapshotChanged(5, smb, { { "Id", smb } });
+    EXPECT_TRUE(d->protocolMirror.contains(smb));
+    d->onSnapshotChanged(6, sdc1, {});
+    EXPECT_FALSE(d->mirrorInfo(sdc1, &info, false));
+
+    d->onSizeChanged(sdb1, 100, 40);
+    EXPECT_TRUE(d->mirrorInfo(sdb1, &info, false));
+    EXPECT_EQ(info.value("SizeUsed").toULongLong(), 60ULL);
+
+    // changed locally, not yet published
+    d->onMountedManually(sdb1);
+    EXPECT_FALSE(d->mirrorInfo(sdb1, &info, false));
+    d->updateMirror(sdb1, { { "Id", sdb1 }, { "MountPoint", "/media/sdb1" } });
+    EXPECT_TRUE(d->mirrorInfo(sdb1, &info, false));
+    EXPECT_EQ(info.value("MountPoint").toString(), QString("/media/sdb1"));
+
+    // a gap drops the mirror
+    d->onSnapshotChanged(8, sdc1, { { "Id", sdc1 } });
+    EXPECT_FALSE(d->mirrorReady);
+    EXPECT_FALSE(d->mirrorInfo(sdb1, &info, false));
+
+    d->resetMirror();
+}
@@ -7,10 +7,15 @@
 
 #include <stubext.h>
 #include <dfm-base/file/local/localfileiconprovider.h>
+#include <dfm-base/file/local/private/localfileiconprovider_p.h>
 
 #include <dfm-io/dwatcher.h>
 
 #include <QDir>
+#include <QPixmap>
+#include <QtConcurrent>
+
+#include <atomic>
 
 #include <gtest/gtest.h>
 
@@ -45,4 +50,48 @@ TEST_F(UT_LocalFileIconProvider, testLocalFileIconProvider)
     EXPECT_TRUE(privder->icon(iconName).isNull());
 }
 
+TEST_F(UT_LocalFileIconProvider, testThemeIconCache)
+{
+    stub_ext::StubExt stub;
+    QString theme("theme1");
+    std::atomic_int resolved { 0 };
+    QPixmap pixmap(16, 16);
+    pixmap.fill(Qt::red);
+    const QIcon themed(pixmap);
+    stub.set_lamda(&QIcon::themeName, [&theme]() {
+        return theme;
+    });
+    stub.set_lamda(static_cast<QIcon (*)(const QString &)>(&QIcon::fromTheme), [&resolved, &themed](const QString &name) {
+        ++resolved;
+        return name.startsWith("icon") || name == "application-x-deb" ? themed : QIcon();
+    });
+
+    LocalFileIconProviderPrivate d;
+    QList<int> threads { 0, 1, 2, 3, 4, 5, 6, 7 };
+    QtConcurrent::blockingMap(threads, [&d](int) {
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_FALSE(d.fromTheme(QString("icon%0").arg(i % 100)).isNull());
+    });
+    EXPECT_EQ(resolved, 100);
+
+    // the fallback is cached with the requested name.
+    EXPECT_FALSE(d.fromTheme("application-vnd.debian.binary-package").isNull());
+    EXPECT_FALSE(d.fromTheme("application-vnd.debian.binary-package").isNull());
+    EXPECT_EQ(resolved, 102);
+
+    // the missing icon is not cached.
+    EXPECT_TRUE(d.fromTheme("missing").isNull());
+    EXPECT_TRUE(d.fromTheme("missing").isNull());
+    EXPECT_EQ(resolved, 104);
+
+    // all icons are resolved again in new theme.
+    theme = "theme2";
+    d.resetThemeIcons();
+    EXPECT_FALSE(d.fromTheme("icon1").isNull());
+    EXPECT_FALSE(d.fromTheme("icon1").isNull());
+    EXPECT_EQ(resolved, 105);
+    EXPECT_EQ(d.themeIcons.size(), 1);
+    EXPECT_EQ(d.themeName, QString("theme2"));
+}
+
 #endif
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/interfaces/sortfileinfo.h>
+
+#include <gtest/gtest.h>
+
+DFMBASE_USE_NAMESPACE
+
+TEST(UT_SortFileInfo, defaultValue)
+{
+    auto info = SortInfoPointer::create();
+    EXPECT_TRUE(info->fileUrl().isEmpty());
+    EXPECT_EQ(info->fileSize(), 0);
+    EXPECT_FALSE(info->isFile());
+    EXPECT_FALSE(info->isDir());
+    EXPECT_FALSE(info->isSymLink());
+    EXPECT_FALSE(info->isHide());
+    EXPECT_FALSE(info->isReadable());
+    EXPECT_FALSE(info->isWriteable());
+    EXPECT_FALSE(info->isExecutable());
+}
+
+TEST(UT_SortFileInfo, setValue)
+{
+    auto info = SortInfoPointer::create();
+    const QUrl url = QUrl::fromLocalFile("/tmp/test");
+    info->setUrl(url);
+    info->setSize(1024);
+    info->setDir(true);
+    info->setHide(true);
+    info->setExecutable(true);
+
+    EXPECT_EQ(info->fileUrl(), url);
+    EXPECT_EQ(info->fileSize(), 1024);
+    EXPECT_TRUE(info->isDir());
+    EXPECT_TRUE(info->isHide());
+    EXPECT_TRUE(info->isExecutable());
+    // the flags are packed, setting one must not touch the others.
+    EXPECT_FALSE(info->isFile());
+    EXPECT_FALSE(info->isSymLink());
+    EXPECT_FALSE(info->isReadable());
+    EXPECT_FALSE(info->isWriteable());
+
+    info->setHide(false);
+    EXPECT_FALSE(info->isHide());
+    EXPECT_TRUE(info->isDir());
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/mimetype/dmimedatabase.h>
+#include <dfm-base/base/standardpaths.h>
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QEventLoop>
+#include <QTimer>
+
+#include <gtest/gtest.h>
+#include "stubext.h"
+
+DFMBASE_USE_NAMESPACE
+
+TEST(UT_DMimeDatabase, testContentCache)
+{
+    QTemporaryDir tmp;
+    ASSERT_TRUE(tmp.isValid());
+    const QString path = tmp.filePath("file.unknownsuffix");
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("text");
+    }
+
+    stub_ext::StubExt stub;
+    // keep the cache out of the user's cache directory.
+    QTemporaryDir cacheDir;
+    ASSERT_TRUE(cacheDir.isValid());
+    using LocationFunc = QString (*)(StandardPaths::StandardLocation);
+    stub.set_lamda(static_cast<LocationFunc>(&StandardPaths::location), [&cacheDir]() {
+        return cacheDir.path();
+    });
+
+    int detected = 0;
+    using DetectFunc = QMimeType (QMimeDatabase::*)(const QString &, QMimeDatabase::MatchMode) const;
+    stub.set_lamda(static_cast<DetectFunc>(&QMimeDatabase::mimeTypeForFile), [&detected]() {
+        ++detected;
+        return QMimeDatabase().mimeTypeForName("text/plain");
+    });
+
+    DMimeDatabase db;
+    EXPECT_EQ(db.mimeTypeForFile(path, QMimeDatabase::MatchDefault, QString()).name(), QString("text/plain"));
+    EXPECT_EQ(DMimeDatabase().mimeTypeForFile(path, QMimeDatabase::MatchDefault, QString()).name(), QString("text/plain"));
+    EXPECT_EQ(detected, 1);
+
+    // the content is changed.
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::Append));
+        file.write(" changed");
+    }
+    EXPECT_EQ(db.mimeTypeForFile(path, QMimeDatabase::MatchDefault, QString()).name(), QString("text/plain"));
+    EXPECT_EQ(detected, 2);
+
+    // only the default mode is cached.
+    db.mimeTypeForFile(path, QMimeDatabase::MatchContent, QString());
+    EXPECT_EQ(detected, 3);
+
+    // the new entries are saved without waiting for the exit.
+    QTimer wait;
+    QEventLoop loop;
+    loop.connect(&wait, &QTimer::timeout, &loop, &QEventLoop::quit);
+    wait.start(2500);
+    loop.exec();
+    EXPECT_TRUE(QFile::exists(cacheDir.filePath("MimeTypes.cache")));
+}
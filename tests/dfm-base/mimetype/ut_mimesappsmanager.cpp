@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/mimetype/mimesappsmanager.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+#include "stubext.h"
+
+DFMBASE_USE_NAMESPACE
+
+class UT_MimesAppsManager : public testing::Test
+{
+public:
+    virtual void SetUp() override
+    {
+        ASSERT_TRUE(tmp.isValid());
+        appsDir = tmp.filePath("applications");
+        indexFile = tmp.filePath("MimeApps.index");
+        QDir().mkpath(appsDir + "/sub");
+
+        const QString apps = appsDir;
+        const QString index = indexFile;
+        const QString none = tmp.filePath("none");
+        stub.set_lamda(&MimesAppsManager::getApplicationsFolders, [apps]() {
+            return QStringList { apps };
+        });
+        stub.set_lamda(&MimesAppsManager::getMimeAppsIndexFile, [index]() {
+            return index;
+        });
+        stub.set_lamda(&MimesAppsManager::getDDEMimeTypeFile, [none]() {
+            return none;
+        });
+        stub.set_lamda(&MimesAppsManager::getMimeInfoCacheFilePath, [none]() {
+            return none;
+        });
+    }
+
+    virtual void TearDown() override
+    {
+        stub.clear();
+        MimesAppsManager::MimeApps.clear();
+        MimesAppsManager::DesktopFiles.clear();
+        MimesAppsManager::DesktopObjs.clear();
+    }
+
+    void writeDesktop(const QString &path, const QString &name, const QString &mimeTypes, bool noDisplay = false)
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        QString content = QString("[Desktop Entry]\nName=%1\nExec=%1 %f\nType=Application\nMimeType=%2\n").arg(name, mimeTypes);
+        if (noDisplay)
+            content.append("NoDisplay=true\n");
+        file.write(content.toUtf8());
+    }
+
+    void reload()
+    {
+        MimesAppsManager::MimeApps.clear();
+        MimesAppsManager::initMimeTypeApps();
+    }
+
+    stub_ext::StubExt stub;
+    QTemporaryDir tmp;
+    QString appsDir;
+    QString indexFile;
+};
+
+TEST_F(UT_MimesAppsManager, testIndexedApps)
+{
+    const QString one = appsDir + "/one.desktop";
+    const QString two = appsDir + "/sub/two.desktop";
+    writeDesktop(one, "one", "text/plain;");
+    writeDesktop(two, "two", "text/plain;image/png;");
+    writeDesktop(appsDir + "/hidden.desktop", "hidden", "text/plain;", true);
+
+    // cold
+    reload();
+    EXPECT_TRUE(QFile::exists(indexFile));
+    EXPECT_EQ(MimesAppsManager::DesktopFiles.size(), 2);
+    EXPECT_EQ(MimesAppsManager::MimeApps.value("text/plain").size(), 2);
+    EXPECT_EQ(MimesAppsManager::MimeApps.value("image/png"), QStringList { two });
+    EXPECT_EQ(MimesAppsManager::DesktopObjs.value(two).desktopExec(), QString("two %f"));
+
+    // warm
+    const QStringList textApps = MimesAppsManager::MimeApps.value("text/plain");
+    reload();
+    EXPECT_EQ(MimesAppsManager::DesktopFiles.size(), 2);
+    EXPECT_EQ(MimesAppsManager::MimeApps.value("text/plain"), textApps);
+    EXPECT_EQ(MimesAppsManager::DesktopObjs.value(one).desktopExec(), QString("one %f"));
+
+    // the changed sub directory is scanned again.
+    const QString three = appsDir + "/sub/three.desktop";
+    writeDesktop(three, "three", "image/png;");
+    QFile::remove(two);
+    reload();
+    EXPECT_EQ(MimesAppsManager::DesktopFiles.size(), 2);
+    EXPECT_EQ(MimesAppsManager::MimeApps.value("image/png"), QStringList { three });
+    EXPECT_FALSE(MimesAppsManager::DesktopObjs.contains(two));
+
+    // a file edited in place leaves the modified time of its directory alone.
+    const qint64 dirModified = QFileInfo(appsDir).lastModified().toMSecsSinceEpoch();
+    writeDesktop(one, "first", "text/plain;image/png;");
+    ASSERT_EQ(QFileInfo(appsDir).lastModified().toMSecsSinceEpoch(), dirModified);
+    reload();
+    EXPECT_EQ(MimesAppsManager::DesktopObjs.value(one).desktopExec(), QString("first %f"));
+    EXPECT_TRUE(MimesAppsManager::MimeApps.value("image/png").contains(one));
+}
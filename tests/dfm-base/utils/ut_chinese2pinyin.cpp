@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dfm-base/utils/chinese2pinyin.h"
+
+#include <QtConcurrent>
+
+#include <gtest/gtest.h>
+
+TEST(UT_Chinese2Pinyin, Chinese2Pinyin)
+{
+    EXPECT_TRUE(Pinyin::Chinese2Pinyin("").isEmpty());
+    EXPECT_EQ(Pinyin::Chinese2Pinyin("abc.txt"), QString("abc.txt"));
+    EXPECT_EQ(Pinyin::Chinese2Pinyin(QString::fromUtf8("中文.txt")), QString("zhong1wen2.txt"));
+    // the first and the last code point of the dict
+    EXPECT_EQ(Pinyin::Chinese2Pinyin(QString(QChar(0x3400))), QString("qiu1"));
+    EXPECT_EQ(Pinyin::Chinese2Pinyin(QString(QChar(0xfa2d))), QString("he4"));
+    EXPECT_EQ(Pinyin::Chinese2Pinyin(QString(QChar(0x3402))), QString(QChar(0x3402)));
+}
+
+TEST(UT_Chinese2Pinyin, Buffer)
+{
+    const QString words = QString::fromUtf8("文件 1");
+    EXPECT_EQ(Pinyin::PinyinLength(words), 11);
+
+    QString out("a/");
+    Pinyin::Chinese2Pinyin(words, out);
+    EXPECT_EQ(out, QString("a/wen2jian4 1"));
+
+    out.resize(0);
+    Pinyin::Chinese2Pinyin(words, out);
+    EXPECT_EQ(out, QString("wen2jian4 1"));
+}
+
+TEST(UT_Chinese2Pinyin, Threads)
+{
+    QList<QString> names;
+    for (int i = 0; i < 64; ++i)
+        names.append(QString::fromUtf8("中文") + QString::number(i));
+
+    QString (*convert)(const QString &) = Pinyin::Chinese2Pinyin;
+    const QList<QString> &results = QtConcurrent::blockingMapped(names, convert);
+    for (int i = 0; i < results.size(); ++i)
+        EXPECT_EQ(results.at(i), QString("zhong1wen2") + QString::number(i));
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/utils/clipboard.h>
+#include <dfm-base/utils/systempathutil.h>
+#include <dfm-base/base/standardpaths.h>
+#include <dfm-base/utils/private/clipboard_p.h>
+
+#include <stubext.h>
+
+#include <QClipboard>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <QUrl>
+
+#include <gtest/gtest.h>
+
+DFMBASE_USE_NAMESPACE
+
+TEST(UT_ClipBoard, testLazyPayload)
+{
+    stub_ext::StubExt stub;
+    QMimeData *published = nullptr;
+    stub.set_lamda(&QClipboard::setMimeData, [&published](QClipboard *, QMimeData *data, QClipboard::Mode) {
+        published = data;
+    });
+
+    const int count = 200000;
+    QList<QUrl> urls;
+    urls.reserve(count);
+    for (int i = 0; i < count; ++i)
+        urls << QUrl::fromLocalFile(QString("/tmp/clipboard/file_%1").arg(i));
+
+    QElapsedTimer timer;
+    timer.start();
+    ClipBoard::setUrlsToClipboard(urls, ClipBoard::kCopyAction);
+    qInfo() << "published" << count << "urls in" << timer.elapsed() << "ms";
+
+    auto data = qobject_cast<ClipBoardMimeData *>(published);
+    ASSERT_TRUE(data);
+    // nothing is serialised until a client asks for a format
+    EXPECT_TRUE(data->payloads.isEmpty());
+    EXPECT_EQ(data->clipboardUrls().size(), count);
+    EXPECT_TRUE(data->hasUrls());
+    EXPECT_TRUE(data->hasFormat("x-special/gnome-copied-files"));
+
+    const QByteArray &gnome = data->data("x-special/gnome-copied-files");
+    EXPECT_TRUE(gnome.startsWith("copy\nfile:///tmp/clipboard/file_0\n"));
+    EXPECT_EQ(gnome.count('\n'), count);
+    EXPECT_EQ(data->payloads.size(), 1);
+
+    EXPECT_EQ(data->urls(), urls);
+    EXPECT_EQ(data->text().count('\n'), count - 1);
+    EXPECT_TRUE(data->text().startsWith("/tmp/clipboard/file_0\n"));
+    EXPECT_EQ(data->data("text/uri-list").count("\r\n"), count);
+
+    delete published;
+}
+
+TEST(UT_ClipBoard, testCutPayload)
+{
+    stub_ext::StubExt stub;
+    QMimeData *published = nullptr;
+    stub.set_lamda(&QClipboard::setMimeData, [&published](QClipboard *, QMimeData *data, QClipboard::Mode) {
+        published = data;
+    });
+
+    const QList<QUrl> urls { QUrl::fromLocalFile("/tmp/clipboard/a") };
+    ClipBoard::setUrlsToClipboard(urls, ClipBoard::kCutAction);
+    ASSERT_TRUE(published);
+    EXPECT_EQ(published->data("x-special/gnome-copied-files"), QByteArray("cut\nfile:///tmp/clipboard/a"));
+    EXPECT_TRUE(published->hasFormat("userId"));
+    delete published;
+
+    // a system path is never cut
+    published = nullptr;
+    const QString &desktop = StandardPaths::location(StandardPaths::kDesktopPath);
+    ClipBoard::setUrlsToClipboard({ QUrl::fromLocalFile(desktop + "/") }, ClipBoard::kCutAction);
+    EXPECT_FALSE(published);
+}
+
+TEST(UT_ClipBoard, testCheckContainsSystemPath)
+{
+    const QString &desktop = StandardPaths::location(StandardPaths::kDesktopPath);
+    QList<QUrl> urls;
+    for (int i = 0; i < 1000; ++i)
+        urls << QUrl::fromLocalFile(desktop + QString("/file_%1").arg(i));
+    EXPECT_FALSE(SystemPathUtil::instance()->checkContainsSystemPath(urls));
+
+    urls << QUrl::fromLocalFile(desktop);
+    EXPECT_TRUE(SystemPathUtil::instance()->checkContainsSystemPath(urls));
+}
+
+TEST(UT_ClipBoard, testIsCut)
+{
+    stub_ext::StubExt stub;
+    const QMimeData *current = nullptr;
+    stub.set_lamda(&QClipboard::mimeData, [&current]() {
+        return current;
+    });
+
+    QList<QUrl> urls;
+    for (int i = 0; i < 10000; ++i)
+        urls << QUrl::fromLocalFile(QString("/tmp/clipboard/file_%1").arg(i));
+
+    ClipBoardMimeData cut(urls, ClipBoard::kCutAction);
+    current = &cut;
+    const quint64 generation = ClipBoard::instance()->clipboardGeneration();
+    ClipBoard::instance()->onClipboardDataChanged();
+    EXPECT_EQ(ClipBoard::instance()->clipboardGeneration(), generation + 1);
+    EXPECT_EQ(ClipBoard::instance()->clipboardAction(), ClipBoard::kCutAction);
+    EXPECT_EQ(ClipBoard::instance()->clipboardFileUrlList(), urls);
+    EXPECT_TRUE(ClipBoard::instance()->isCut(urls.last()));
+    EXPECT_FALSE(ClipBoard::instance()->isCut(QUrl::fromLocalFile("/tmp/clipboard/other")));
+
+    // a copy dims nothing
+    ClipBoardMimeData copy(urls, ClipBoard::kCopyAction);
+    current = &copy;
+    ClipBoard::instance()->onClipboardDataChanged();
+    EXPECT_EQ(ClipBoard::instance()->clipboardGeneration(), generation + 2);
+    EXPECT_FALSE(ClipBoard::instance()->isCut(urls.first()));
+
+    // data published by another application
+    QMimeData foreign;
+    foreign.setData("x-special/gnome-copied-files", "cut\nfile:///tmp/clipboard/file_0");
+    foreign.setUrls({ urls.first() });
+    current = &foreign;
+    ClipBoard::instance()->onClipboardDataChanged();
+    EXPECT_TRUE(ClipBoard::instance()->isCut(urls.first()));
+    EXPECT_FALSE(ClipBoard::instance()->isCut(urls.last()));
+
+    current = nullptr;
+    ClipBoard::instance()->onClipboardDataChanged();
+    EXPECT_FALSE(ClipBoard::instance()->isCut(urls.first()));
+    EXPECT_TRUE(ClipBoard::instance()->clipboardFileUrlList().isEmpty());
+}
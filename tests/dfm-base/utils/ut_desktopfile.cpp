@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/utils/desktopfile.h>
+
+#include <QFile>
+#include <QDataStream>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+DFMBASE_USE_NAMESPACE
+
+namespace {
+void writeFile(const QString &path, const QByteArray &content)
+{
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write(content);
+}
+}
+
+TEST(UT_DesktopFile, testParse)
+{
+    QTemporaryDir tmp;
+    ASSERT_TRUE(tmp.isValid());
+    const QString path = tmp.filePath("app.desktop");
+    writeFile(path, "# comment\n"
+                    "[Desktop Entry]\n"
+                    "Name=App\n"
+                    "Name[xx_YY]=Localized\n"
+                    "GenericName = Generic\n"
+                    "Exec=app %U\n"
+                    "Icon=app-icon\n"
+                    "Categories=Utility; Office;\n"
+                    "MimeType=text/plain;image/png;\n"
+                    "X-Deepin-Vendor=deepin\n"
+                    "X-DDE-File-Manager-Custom-Open=text/plain\n"
+                    "\n"
+                    "[Desktop Action New]\n"
+                    "Exec=app --new\n"
+                    "NoDisplay=true\n");
+
+    DesktopFile desktop(path);
+    EXPECT_EQ(desktop.desktopFileName(), path);
+    EXPECT_EQ(desktop.desktopLocalName(), QString("App"));
+    EXPECT_EQ(desktop.desktopDisplayName(), QString("Generic"));
+    EXPECT_EQ(desktop.desktopExec(), QString("app %U"));
+    EXPECT_EQ(desktop.desktopIcon(), QString("app-icon"));
+    EXPECT_EQ(desktop.desktopType(), QString("Application"));
+    EXPECT_EQ(desktop.desktopCategories(), QStringList({ "Utility", "Office", "" }));
+    EXPECT_EQ(desktop.desktopMimeType(), QStringList({ "text/plain", "image/png", "" }));
+    EXPECT_EQ(desktop.desktopCustomOpen(), QString("text/plain"));
+    EXPECT_FALSE(desktop.isNoShow());
+
+    EXPECT_TRUE(DesktopFile(tmp.filePath("none.desktop")).desktopExec().isEmpty());
+}
+
+TEST(UT_DesktopFile, testCache)
+{
+    QTemporaryDir tmp;
+    ASSERT_TRUE(tmp.isValid());
+    const QString path = tmp.filePath("app.desktop");
+    writeFile(path, "[Desktop Entry]\nName=One\nExec=one\n");
+    EXPECT_EQ(DesktopFile(path).desktopLocalName(), QString("One"));
+    EXPECT_EQ(DesktopFile(path).desktopExec(), QString("one"));
+
+    // the size is changed, it must be parsed again.
+    writeFile(path, "[Desktop Entry]\nName=Two\nExec=two\nNoDisplay=true\n");
+    DesktopFile changed(path);
+    EXPECT_EQ(changed.desktopLocalName(), QString("Two"));
+    EXPECT_TRUE(changed.isNoShow());
+
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << changed;
+    }
+    DesktopFile restored;
+    QDataStream in(data);
+    in >> restored;
+    EXPECT_EQ(restored.desktopFileName(), path);
+    EXPECT_EQ(restored.desktopExec(), QString("two"));
+    EXPECT_TRUE(restored.isNoShow());
+}
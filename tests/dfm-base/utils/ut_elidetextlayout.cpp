@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dfm-base/utils/elidetextlayout.h"
+#include "dfm-base/utils/elidetextlayoutcache.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QTextDocument>
+
+#include <gtest/gtest.h>
+
+DFMBASE_USE_NAMESPACE
+
+TEST(UT_ElideTextLayout, layout_CachedLinesMatch)
+{
+    const QString name("a_very_long_file_name_that_must_be_wrapped_and_elided.txt");
+    const QRectF rect(0, 0, 60, 40);
+    ElideTextLayoutCache cache;
+
+    ElideTextLayout first(name);
+    first.setAttribute(ElideTextLayout::kLineHeight, 16);
+    first.setLayoutCache(&cache);
+    QStringList firstLines;
+    const auto &firstRects = first.layout(rect, Qt::ElideMiddle, nullptr, Qt::NoBrush, &firstLines);
+
+    const ElideTextLayoutCache::Entry *entry = cache.find(first.cacheKey(rect.size(), Qt::ElideMiddle));
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(entry->lines.size(), firstRects.size());
+
+    // same text at another position reuses the cached lines without filling the document
+    ElideTextLayout second;
+    second.setLayoutCache(&cache);
+    second.reset(name);
+    second.setAttribute(ElideTextLayout::kLineHeight, 16);
+    QStringList secondLines;
+    const auto &secondRects = second.layout(rect.translated(10, 20), Qt::ElideMiddle, nullptr, Qt::NoBrush, &secondLines);
+    EXPECT_FALSE(second.documentSynced);
+
+    ASSERT_EQ(firstRects.size(), secondRects.size());
+    for (int i = 0; i < firstRects.size(); ++i)
+        EXPECT_EQ(firstRects.at(i).translated(10, 20), secondRects.at(i));
+    EXPECT_EQ(firstLines, secondLines);
+
+    QImage image(100, 100, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    EXPECT_EQ(second.layout(rect, Qt::ElideMiddle, &painter), firstRects);
+}
+
+TEST(UT_ElideTextLayout, layout_NotCached)
+{
+    const QRectF rect(0, 0, 60, 40);
+    ElideTextLayoutCache cache;
+
+    ElideTextLayout disabled("disabled");
+    disabled.layout(rect, Qt::ElideMiddle);
+
+    ElideTextLayout object("tagged");
+    object.setLayoutCache(&cache);
+    object.documentHandle()->setPlainText(QString(QChar::ObjectReplacementCharacter) + "tagged");
+    object.layout(rect, Qt::ElideMiddle);
+
+    EXPECT_FALSE(cache.find(disabled.cacheKey(rect.size(), Qt::ElideMiddle)));
+    EXPECT_FALSE(cache.find(object.cacheKey(rect.size(), Qt::ElideMiddle)));
+}
+
+TEST(UT_ElideTextLayout, reset)
+{
+    ElideTextLayout layout("first");
+    layout.setAttribute(ElideTextLayout::kBackgroundRadius, 4);
+    layout.documentHandle()->setPlainText(QString(QChar::ObjectReplacementCharacter) + "first");
+
+    layout.reset("second");
+    EXPECT_EQ(layout.text(), QString("second"));
+    EXPECT_EQ(layout.attribute<int>(ElideTextLayout::kBackgroundRadius), 0);
+    EXPECT_EQ(layout.documentHandle()->toPlainText(), QString("second"));
+}
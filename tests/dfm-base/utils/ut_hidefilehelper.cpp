@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/utils/hidefilehelper.h>
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/file/local/syncfileinfo.h>
+#include <dfm-base/dfm_global_defines.h>
+
+#include <QDir>
+#include <QFile>
+#include <QSet>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+
+DFMBASE_USE_NAMESPACE
+
+namespace {
+void writeHidden(const QString &path, const QByteArray &content)
+{
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write(content);
+}
+}
+
+TEST(UT_HideFileHelper, testHideListOf)
+{
+    QTemporaryDir tmp;
+    ASSERT_TRUE(tmp.isValid());
+    const QString dir = tmp.path();
+    const QString hidden = dir + "/.hidden";
+
+    // no .hidden file.
+    EXPECT_TRUE(HideFileHelper::hideListOf(dir).isEmpty());
+
+    writeHidden(hidden, "a\nb\n\n");
+    EXPECT_EQ(HideFileHelper::hideListOf(dir), QSet<QString>({ "a", "b" }));
+
+    // rewrite it in place with the same size and modified time, the cached one is used.
+    struct stat st;
+    ASSERT_EQ(::stat(QFile::encodeName(hidden).constData(), &st), 0);
+    writeHidden(hidden, "c\nd\n\n");
+    const struct timespec times[2] { st.st_atim, st.st_mtim };
+    ASSERT_EQ(::utimensat(AT_FDCWD, QFile::encodeName(hidden).constData(), times, 0), 0);
+    EXPECT_EQ(HideFileHelper::hideListOf(dir), QSet<QString>({ "a", "b" }));
+
+    // the watcher reports the change.
+    HideFileHelper::invalidateHideList(dir);
+    EXPECT_EQ(HideFileHelper::hideListOf(dir), QSet<QString>({ "c", "d" }));
+
+    writeHidden(hidden, "e\n");
+    EXPECT_EQ(HideFileHelper::hideListOf(dir), QSet<QString>({ "e" }));
+}
+
+TEST(UT_HideFileHelper, testSetFilesHidden)
+{
+    InfoFactory::regClass<SyncFileInfo>(Global::Scheme::kFile);
+
+    QTemporaryDir tmp;
+    ASSERT_TRUE(tmp.isValid());
+    const QString dirA = tmp.path() + "/a";
+    const QString dirB = tmp.path() + "/b";
+    ASSERT_TRUE(QDir().mkpath(dirA));
+    ASSERT_TRUE(QDir().mkpath(dirB));
+    for (const QString &path : { dirA + "/x", dirA + "/y", dirB + "/z" })
+        writeHidden(path, "");
+
+    writeHidden(dirA + "/.hidden", "w\n");
+    struct stat before;
+    ASSERT_EQ(::stat(QFile::encodeName(dirA + "/.hidden").constData(), &before), 0);
+
+    const QList<QUrl> urls { QUrl::fromLocalFile(dirA + "/x"), QUrl::fromLocalFile(dirA + "/y"), QUrl::fromLocalFile(dirB + "/z") };
+    EXPECT_TRUE(HideFileHelper::setFilesHidden(urls, HideFileHelper::kToggleAction));
+    EXPECT_EQ(HideFileHelper::hideListOf(dirA), QSet<QString>({ "w", "x", "y" }));
+    EXPECT_EQ(HideFileHelper::hideListOf(dirB), QSet<QString>({ "z" }));
+
+    // the .hidden file is replaced as a whole, no temporary file is left behind
+    struct stat after;
+    ASSERT_EQ(::stat(QFile::encodeName(dirA + "/.hidden").constData(), &after), 0);
+    EXPECT_NE(before.st_ino, after.st_ino);
+    EXPECT_EQ(QDir(dirA).entryList(QDir::Files | QDir::Hidden).size(), 3);
+
+    EXPECT_TRUE(HideFileHelper::setFilesHidden({ urls.first(), urls.last() }, HideFileHelper::kToggleAction));
+    EXPECT_EQ(HideFileHelper::hideListOf(dirA), QSet<QString>({ "w", "y" }));
+    EXPECT_TRUE(HideFileHelper::hideListOf(dirB).isEmpty());
+
+    EXPECT_TRUE(HideFileHelper::setFilesHidden(urls, HideFileHelper::kHideAction));
+    EXPECT_EQ(HideFileHelper::hideListOf(dirA), QSet<QString>({ "w", "x", "y" }));
+    EXPECT_TRUE(HideFileHelper::setFilesHidden(urls, HideFileHelper::kUnhideAction));
+    EXPECT_EQ(HideFileHelper::hideListOf(dirA), QSet<QString>({ "w" }));
+    EXPECT_TRUE(HideFileHelper::hideListOf(dirB).isEmpty());
+}
@@ -172,6 +172,7 @@ TEST_F(TestGridCore, findVoidPos)
     EXPECT_EQ(pos.second, QPoint(0,0));
 
     core.posItem[1].insert(QPoint(0, 0), QString("0,0"));
+    core.invalidOccupancy(1);
     EXPECT_TRUE(core.findVoidPos(pos));
     EXPECT_EQ(pos.first, 1);
     EXPECT_EQ(pos.second, QPoint(0,2));
@@ -261,3 +262,66 @@ TEST(AppendOper, tryAppendAfter)
     EXPECT_TRUE(ao.overload.contains(QString("5")));
     EXPECT_EQ(ao.overload.size(), 1);
 }
+
+TEST(GridOccupancy, nextVoid)
+{
+    QHash<QPoint, QString> used;
+    // fill the first 70 cells of a 10x10 surface, crossing a word boundary.
+    for (int i = 0; i < 70; ++i)
+        used.insert(QPoint(i / 10, i % 10), QString::number(i));
+    used.insert(QPoint(20, 20), QString("outside"));
+
+    GridOccupancy occ(QSize(10, 10), used);
+    EXPECT_TRUE(occ.matches(QSize(10, 10), used.size()));
+    EXPECT_FALSE(occ.matches(QSize(10, 11), used.size()));
+    EXPECT_EQ(occ.nextVoid(0), 70);
+    EXPECT_EQ(occ.nextVoid(85), 85);
+
+    occ.setUsed(QPoint(3, 3), false);
+    EXPECT_EQ(occ.nextVoid(0), 33);
+    EXPECT_EQ(occ.nextVoid(34), 70);
+
+    for (int i = 0; i < 100; ++i)
+        occ.setUsed(occ.pos(i), true);
+    EXPECT_EQ(occ.nextVoid(0), -1);
+}
+
+TEST_F(TestGridCore, voidPos_afterOperations)
+{
+    core.insert(1, QPoint(0, 0), QString("0,0"));
+    GridPos pos;
+    EXPECT_TRUE(core.findVoidPos(pos));
+    EXPECT_EQ(pos.second, QPoint(0, 2));
+
+    core.remove(1, QString("0,1"));
+    EXPECT_TRUE(core.findVoidPos(pos));
+    EXPECT_EQ(pos.second, QPoint(0, 1));
+    EXPECT_EQ(core.voidPos(1).size(), 22);
+
+    // written without GridCore
+    core.posItem[1].insert(QPoint(0, 1), QString("0,1"));
+    core.invalidOccupancy(1);
+    EXPECT_TRUE(core.findVoidPos(pos));
+    EXPECT_EQ(pos.second, QPoint(0, 2));
+
+    // resized without GridCore
+    core.surfaces.insert(1, QSize(1, 2));
+    core.invalidOccupancy(1);
+    EXPECT_TRUE(core.voidPos(1).isEmpty());
+}
+
+TEST_F(TestGridCore, voidPos_afterMove)
+{
+    EXPECT_EQ(core.voidPos(1).size(), 22);
+
+    MoveGridOper move(&core);
+    EXPECT_TRUE(move.move(GridPos(1, QPoint(4, 4)), GridPos(1, QPoint(0, 1)), { QString("0,1") }));
+    core.applay(&move);
+
+    GridPos pos;
+    EXPECT_TRUE(core.findVoidPos(pos));
+    EXPECT_EQ(pos.second, QPoint(0, 0));
+    EXPECT_EQ(core.voidPos(1).size(), 22);
+    EXPECT_FALSE(core.voidPos(1).contains(QPoint(4, 4)));
+    EXPECT_TRUE(core.voidPos(1).contains(QPoint(0, 1)));
+}
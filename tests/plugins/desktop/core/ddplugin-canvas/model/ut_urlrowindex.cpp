@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "model/urlrowindex.h"
+
+#include <gtest/gtest.h>
+
+using namespace ddplugin_canvas;
+
+namespace {
+QList<QUrl> makeUrls(int count)
+{
+    QList<QUrl> urls;
+    for (int i = 0; i < count; ++i)
+        urls.append(QUrl::fromLocalFile(QString("/tmp/%0").arg(i)));
+    return urls;
+}
+}
+
+TEST(UrlRowIndex, row)
+{
+    auto list = makeUrls(10);
+    UrlRowIndex idx;
+    // search the list if it is not indexed.
+    EXPECT_EQ(idx.row(list, list.at(3)), 3);
+
+    idx.reset(list);
+    for (int i = 0; i < list.size(); ++i)
+        EXPECT_EQ(idx.row(list, list.at(i)), i);
+
+    EXPECT_EQ(idx.row(list, QUrl::fromLocalFile("/tmp/none")), -1);
+}
+
+TEST(UrlRowIndex, modify)
+{
+    auto list = makeUrls(10);
+    UrlRowIndex idx;
+    idx.reset(list);
+
+    QUrl url = QUrl::fromLocalFile("/tmp/new");
+    list.append(url);
+    idx.inserted(url, list.size() - 1);
+    EXPECT_EQ(idx.row(list, url), 10);
+
+    QUrl rm = list.takeAt(2);
+    idx.removed(rm, 2);
+    EXPECT_EQ(idx.row(list, rm), -1);
+    for (int i = 0; i < list.size(); ++i)
+        EXPECT_EQ(idx.row(list, list.at(i)), i);
+
+    QUrl rep = QUrl::fromLocalFile("/tmp/rep");
+    QUrl old = list.at(5);
+    list.replace(5, rep);
+    idx.replaced(old, rep, 5);
+    EXPECT_EQ(idx.row(list, rep), 5);
+    EXPECT_EQ(idx.row(list, old), -1);
+}
+
+TEST(UrlRowIndex, removeAndAppend)
+{
+    auto list = makeUrls(100);
+    UrlRowIndex idx;
+    idx.reset(list);
+
+    // the rows after a removed one are shifted without reindexing them.
+    for (int i = 0; i < 60; ++i) {
+        const int row = (i * 7) % list.size();
+        idx.removed(list.takeAt(row), row);
+        const QUrl url = QUrl::fromLocalFile(QString("/tmp/append%0").arg(i));
+        list.append(url);
+        idx.inserted(url, list.size() - 1);
+    }
+
+    for (int i = 0; i < list.size(); ++i)
+        EXPECT_EQ(idx.row(list, list.at(i)), i);
+}
+
+TEST(UrlRowIndex, outOfStep)
+{
+    auto list = makeUrls(10);
+    UrlRowIndex idx;
+    idx.reset(list);
+
+    // the list is changed without notifying the index.
+    std::reverse(list.begin(), list.end());
+    for (int i = 0; i < list.size(); ++i)
+        EXPECT_EQ(idx.row(list, list.at(i)), i);
+}
@@ -191,6 +191,7 @@ TEST_F(UT_DodgeItemsOper, findEmpty)
     EXPECT_EQ(res,1);
 
     qq->surfaces.insert(1,QSize(1,1));
+    qq->invalidOccupancy(1);
     res = qq->findEmptyBackward(1,2,2);
     EXPECT_EQ(res,4);
 
@@ -214,12 +215,14 @@ TEST_F(UT_DodgeItemsOper, reloach)
    qq->posItem.insert(1,pos);
 
    qq->surfaces.insert(1,QSize(2,2));
+   qq->invalidOccupancy(1);
    res = qq->reloachForward(1,1,2);
 
    EXPECT_EQ(res,QList{QString("temp_str")});
 
    qq->posItem.clear();
    qq->posItem.insert(1,pos);
+   qq->invalidOccupancy(1);
    res = qq->reloachBackward(1,1,2);
 
    EXPECT_EQ(res,QList{QString("temp_str")});
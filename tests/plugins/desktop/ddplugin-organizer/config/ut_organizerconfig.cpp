@@ -85,15 +85,14 @@ TEST_F(UT_OrganizerConfig, CollectionBase2)
     EXPECT_EQ(base->key,"temp_key");
     EXPECT_EQ(base->name,"temp_name");
     QList list{QUrl("temp_url")};
-    EXPECT_EQ(base->items,list);
+    EXPECT_EQ(base->items(),list);
 }
 
 TEST_F(UT_OrganizerConfig, updateCollectionBase)
 {
-    CollectionBaseDataPtr base(new CollectionBaseData);
+    CollectionBaseDataPtr base(new CollectionBaseData({ QUrl("temp_url") }));
     base->name = "temp_name";
     base->key = "temp_key";
-    base->items = QList{QUrl("temp_url")};
 
     organize->updateCollectionBase(true, base);
 
@@ -111,10 +110,9 @@ TEST_F(UT_OrganizerConfig, updateCollectionBase)
 
 TEST_F(UT_OrganizerConfig, writeCollectionBase)
 {
-    CollectionBaseDataPtr base(new CollectionBaseData);
+    CollectionBaseDataPtr base(new CollectionBaseData({ QUrl("temp_url") }));
     base->name = "temp_name";
     base->key = "temp_key";
-    base->items = QList{QUrl("temp_url")};
     QList<CollectionBaseDataPtr> list_ptr = {base};
 
     organize->writeCollectionBase(true, list_ptr);
@@ -75,7 +75,7 @@ TEST(CollectionItemDelegate, paint)
     EXPECT_TRUE(label);
 }
 
-TEST(CollectionItemDelegate, createTextlayout)
+TEST(CollectionItemDelegate, textLayout)
 {
     CollectionView view("1", nullptr);
     CollectionItemDelegate obj(&view);
@@ -98,19 +98,21 @@ TEST(CollectionItemDelegate, createTextlayout)
     QPainter pa;
 
     obj.d->textLineHeight = 11;
-    auto lay = obj.d->createTextlayout(QModelIndex(0, 0, nullptr, nullptr), &pa);
+    auto lay = obj.d->textLayout(QModelIndex(0, 0, nullptr, nullptr), &pa);
     EXPECT_EQ(lay->text(), QString("test"));
     EXPECT_EQ(lay->attribute<int>(ElideTextLayout::kLineHeight), 11);
     EXPECT_EQ(lay->attribute<int>(ElideTextLayout::kAlignment), Qt::AlignHCenter);
     EXPECT_EQ(lay->attribute<uint>(ElideTextLayout::kWrapMode), (uint)QTextOption::WrapAtWordBoundaryOrAnywhere);
     EXPECT_EQ(lay->attribute<QFont>(ElideTextLayout::kFont), pa.font());
     EXPECT_EQ(lay->attribute<Qt::LayoutDirection>(ElideTextLayout::kTextDirection), pa.layoutDirection());
-    delete lay;
+    lay->setAttribute(ElideTextLayout::kBackgroundRadius, 4);
 
+    // the layout is reused and its attributes are reset.
     suffix = true;
-    lay = obj.d->createTextlayout(QModelIndex(0, 0, nullptr, nullptr), &pa);
+    EXPECT_EQ(obj.d->textLayout(QModelIndex(0, 0, nullptr, nullptr), &pa), lay);
     EXPECT_EQ(lay->text(), QString("test.log"));
-    delete lay;
+    EXPECT_EQ(lay->attribute<int>(ElideTextLayout::kBackgroundRadius), 0);
+    EXPECT_EQ(lay->attribute<int>(ElideTextLayout::kLineHeight), 11);
 }
 
 TEST(CollectionItemDelegate, updateItemSizeHint)
@@ -34,22 +34,21 @@ TEST_F(CustomDataHandlerTest, check)
     QUrl url1("temp_url1");
     QSet<QUrl> vaild{url};
 
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
-    ptr->items.push_back(url1);
-    handler->collections.insert("temp_str", ptr);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url, url1 }));
+    ptr->key = "temp_str";
+    handler->addCollection(ptr);
     EXPECT_NO_FATAL_FAILURE(handler->check(vaild));
-    EXPECT_FALSE(handler->collections["temp_str"]->items.contains(url1));
+    EXPECT_FALSE(handler->collection("temp_str")->items().contains(url1));
+    EXPECT_TRUE(handler->key(url1).isEmpty());
 }
 
 TEST_F(CustomDataHandlerTest, remove)
 {
     QUrl url("temp_url");
     QUrl url1("temp_url1");
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
-    ptr->items.push_back(url1);
-    handler->collections.insert("temp_str", ptr);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url, url1 }));
+    ptr->key = "temp_str";
+    handler->addCollection(ptr);
     QString res = handler->remove(url);
     EXPECT_EQ(res,"temp_str");
 
@@ -61,15 +60,15 @@ TEST_F(CustomDataHandlerTest, replace)
 {
     QUrl url("temp_url");
     QUrl url1("temp_url1");
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url }));
     ptr->key = QString("temp_key");
-    handler->collections.insert("temp_str", ptr);
+    handler->addCollection(ptr);
 
     QString res = handler->replace(url,url1);
     EXPECT_EQ(res,"temp_key");
+    EXPECT_EQ(handler->key(url1), QString("temp_key"));
 
-    handler->collections["temp_str"]->items.push_back(url1);
+    handler->insertItem("temp_key", url);
     res = handler->replace(url,url1);
     EXPECT_EQ(res,nullptr);
 }
@@ -78,18 +77,18 @@ TEST_F(CustomDataHandlerTest, acceptRename)
 {
     QUrl url("temp_url");
     QUrl url1("temp_url1");
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
-    handler->collections.insert("temp_str", ptr);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url }));
+    ptr->key = "temp_str";
+    handler->addCollection(ptr);
     EXPECT_TRUE(handler->acceptRename(url,url1));
 }
 
 TEST_F(CustomDataHandlerTest, acceptInsert)
 {
     QUrl url("temp_url");
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
-    handler->collections.insert("temp_str", ptr);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url }));
+    ptr->key = "temp_str";
+    handler->addCollection(ptr);
     EXPECT_TRUE(handler->acceptInsert(url));
 }
 
@@ -98,9 +97,9 @@ TEST_F(CustomDataHandlerTest, acceptReset)
     QUrl url("temp_url");
     QUrl url1("temp_url1");
     QList<QUrl> list{url,url1};
-    CollectionBaseDataPtr ptr(new CollectionBaseData());
-    ptr->items.push_back(url);
-    handler->collections.insert("temp_str", ptr);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url }));
+    ptr->key = "temp_str";
+    handler->addCollection(ptr);
     QList<QUrl> res =  handler->acceptReset(list);
     EXPECT_TRUE(res.contains(url));
     EXPECT_FALSE(res.contains(url1));
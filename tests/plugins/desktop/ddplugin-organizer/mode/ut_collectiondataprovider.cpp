@@ -56,7 +56,8 @@ TEST_F(UT_CollectionDataProvider, name)
 {
     CollectionBaseDataPtr data(new CollectionBaseData);
     data.value->name = "temp";
-    prov->collections["window"] = data;
+    data.value->key = "window";
+    prov->addCollection(data);
     const QString str = "window";
     QUrl url("temp");
     prov->items(str);
@@ -68,10 +69,9 @@ TEST_F(UT_CollectionDataProvider, name)
 TEST_F(UT_CollectionDataProvider, moveUrls)
 {
     QUrl url("temp");
-    CollectionBaseDataPtr data(new CollectionBaseData);
-    data.value->items.push_back(url);
-
-    prov->collections["window"] = data;
+    CollectionBaseDataPtr data(new CollectionBaseData({ url }));
+    data.value->key = "window";
+    prov->addCollection(data);
 
     QList list{url};
     QString targetKey = "window";
@@ -131,3 +131,50 @@ TEST_F(UT_CollectionDataProvider, takePreItem)
 }
 
 
+
+TEST_F(UT_CollectionDataProvider, locate)
+{
+    QUrl one("file:///one");
+    QUrl two("file:///two");
+    QUrl three("file:///three");
+    CollectionBaseDataPtr first(new CollectionBaseData({ one, two }));
+    first->key = "first";
+    CollectionBaseDataPtr second(new CollectionBaseData);
+    second->key = "second";
+    prov->addCollection(first);
+    prov->addCollection(second);
+
+    QString key;
+    int index = -1;
+    EXPECT_TRUE(prov->locate(two, &key, &index));
+    EXPECT_EQ(key, QString("first"));
+    EXPECT_EQ(index, 1);
+    EXPECT_FALSE(prov->locate(three, &key));
+
+    // items moved through the provider are indexed at once.
+    EXPECT_TRUE(prov->removeItem("first", two));
+    EXPECT_TRUE(prov->insertItem("second", two));
+    EXPECT_EQ(prov->key(two), QString("second"));
+    EXPECT_TRUE(prov->contains("second", two));
+    EXPECT_FALSE(prov->contains("first", two));
+
+    // the positions after an insertion are shifted.
+    EXPECT_TRUE(prov->insertItem("first", three, 0));
+    EXPECT_TRUE(prov->locate(one, &key, &index));
+    EXPECT_EQ(key, QString("first"));
+    EXPECT_EQ(index, 1);
+    EXPECT_EQ(first->items(), QList<QUrl>({ three, one }));
+
+    QUrl four("file:///four");
+    EXPECT_TRUE(prov->replaceItem("first", one, four));
+    EXPECT_FALSE(prov->locate(one, &key));
+    EXPECT_TRUE(prov->locate(four, &key, &index));
+    EXPECT_EQ(index, 1);
+
+    prov->setItems("first", { four });
+    EXPECT_FALSE(prov->locate(three, &key));
+    EXPECT_TRUE(prov->contains("first", four));
+
+    prov->removeCollection("second");
+    EXPECT_TRUE(prov->key(two).isEmpty());
+}
@@ -162,10 +162,10 @@ TEST_F(UT_CustomMode, rebuild)
         call = true;
     });
     mode->d->dataHandler = new CustomDataHandler;
-    CollectionBaseDataPtr ptr(new CollectionBaseData);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ QUrl("temp_qurl") }));
     ptr.value->name = QString("temp");
-    ptr.value->items = QList { QUrl("temp_qurl") };
-    mode->d->dataHandler->collections["windos"] = ptr;
+    ptr.value->key = QString("windos");
+    mode->d->dataHandler->addBaseData(ptr);
     SurfacePointer surfPtr(new Surface);
     mode->surfaces.push_back(surfPtr);
     mode->rebuild();
@@ -231,10 +231,10 @@ TEST_F(UT_CustomMode, filterDataRested)
     QList<QUrl> urls;
     urls.append(url);
     mode->d->dataHandler = new CustomDataHandler;
-    CollectionBaseDataPtr ptr(new CollectionBaseData);
-    ptr.value->items = QList { QUrl("temp") };
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ QUrl("temp") }));
+    ptr.value->key = QString("window");
 
-    mode->d->dataHandler->collections["window"] = ptr;
+    mode->d->dataHandler->addBaseData(ptr);
 
     EXPECT_TRUE(mode->filterDataRested(&urls));
 }
@@ -270,11 +270,10 @@ TEST_F(UT_CustomMode, filterDropData)
     mode->canvasViewShell = &ViewShell;
     mode->canvasGridShell = &GridShell;
     mode->canvasModelShell = &ModelShell;
-    CollectionBaseDataPtr ptr(new CollectionBaseData);
-    ptr.value->items = QList { QUrl("temp") };
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ QUrl("temp") }));
     ptr.value->key = QString("temp_key");
     mode->d->dataHandler = new CustomDataHandler;
-    mode->d->dataHandler->collections["window"] = ptr;
+    mode->d->dataHandler->addBaseData(ptr);
 
     EXPECT_TRUE(mode->filterDropData(viewIndex, &mimeData, viewPoint));
     mode->model = nullptr;
@@ -320,11 +319,9 @@ TEST_F(UT_CustomMode, onNewCollection)
     mode->onNewCollection(list);
 
     EXPECT_TRUE(call);
-    for (auto it = mode->d->dataHandler->collections.begin();
-         it != mode->d->dataHandler->collections.end();
-         it++) {
-        EXPECT_EQ((*it)->name, "New Collection");
-        EXPECT_EQ((*it)->items, list);
+    for (const CollectionBaseDataPtr &base : mode->d->dataHandler->baseDatas()) {
+        EXPECT_EQ(base->name, "New Collection");
+        EXPECT_EQ(base->items(), list);
     }
     mode->model = nullptr;
 }
@@ -368,11 +365,10 @@ TEST_F(UT_CustomMode, onDeleteCollection)
     CollectionHolderPointer holder_ptr(CollectionHolderPointer(new CollectionHolder(uuid, nullptr)));
     mode->d->holders["temp_key"] = holder_ptr;
 
-    CollectionBaseDataPtr ptr(new CollectionBaseData);
-    ptr.value->items = QList { QUrl("temp") };
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ QUrl("temp") }));
     ptr.value->key = QString("temp_key");
     mode->d->dataHandler = new CustomDataHandler;
-    mode->d->dataHandler->collections["window"] = ptr;
+    mode->d->dataHandler->addBaseData(ptr);
 
     mode->onDeleteCollection("temp_key");
 
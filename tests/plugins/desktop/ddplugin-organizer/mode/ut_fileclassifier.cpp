@@ -63,7 +63,8 @@ TEST_F(TestFileClassifier, createClassifier)
 TEST_F(TestFileClassifier, construct)
 {
      CollectionBaseDataPtr dp(new CollectionBaseData);
-     collections.insert("1", dp);
+     dp->key = "1";
+     addCollection(dp);
      QList<CollectionBaseDataPtr> in;
      stub.set_lamda(&ConfigPresenter::saveNormalProfile,
                     [&in](ConfigPresenter *, const QList<CollectionBaseDataPtr> &baseDatas){
@@ -94,12 +95,12 @@ public:
         dp.reset(new CollectionBaseData);
         dp->name = "one";
         dp->key = "1";
-        this->collections.insert("1", dp);
+        addCollection(dp);
 
         dp2.reset(new CollectionBaseData);
         dp2->name = "two";
         dp2->key = "2";
-        this->collections.insert("2", dp2);
+        addCollection(dp2);
     }
 
     QStringList types;
@@ -122,27 +123,27 @@ TEST_F(TestFileClassifier2, reset)
 
     this->reset(ins);
 
-    ASSERT_EQ(this->collections.size(), 2);
+    ASSERT_EQ(this->allCollections().size(), 2);
 
     {
-        auto data = this->collections.value("1");
+        auto data = this->collection("1");
         ASSERT_NE(data, nullptr);
         EXPECT_EQ(data->key, QString("1"));
         EXPECT_EQ(data->name, QString("one"));
-        ASSERT_EQ(data->items.size(), 2);
-        EXPECT_EQ(data->items.first(), one1);
-        EXPECT_EQ(data->items.last(), one2);
+        ASSERT_EQ(data->items().size(), 2);
+        EXPECT_EQ(data->items().first(), one1);
+        EXPECT_EQ(data->items().last(), one2);
 
         EXPECT_EQ(this->baseData("1"), data);
     }
 
     {
-        auto data = this->collections.value("2");
+        auto data = this->collection("2");
         ASSERT_NE(data, nullptr);
         EXPECT_EQ(data->key, QString("2"));
         EXPECT_EQ(data->name, QString("two"));
-        ASSERT_EQ(data->items.size(), 1);
-        EXPECT_EQ(data->items.first(), two1);
+        ASSERT_EQ(data->items().size(), 1);
+        EXPECT_EQ(data->items().first(), two1);
 
         EXPECT_EQ(this->baseData("2"), data);
     }
@@ -154,37 +155,37 @@ TEST_F(TestFileClassifier2, replace)
 
     // new is unknown
     {
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
         EXPECT_TRUE(this->replace(one1, test).isEmpty());
-        EXPECT_TRUE(dp->items.isEmpty());
-        EXPECT_TRUE(dp2->items.isEmpty());
+        EXPECT_TRUE(dp->items().isEmpty());
+        EXPECT_TRUE(dp2->items().isEmpty());
         EXPECT_TRUE(types.isEmpty());
     }
 
     // new is same type
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
         EXPECT_EQ(this->replace(one1, one2), QString("1"));
-        ASSERT_EQ(dp->items.size(), 1);
-        EXPECT_EQ(dp->items.first(), one2);
-        EXPECT_TRUE(dp2->items.isEmpty());
+        ASSERT_EQ(dp->items().size(), 1);
+        EXPECT_EQ(dp->items().first(), one2);
+        EXPECT_TRUE(dp2->items().isEmpty());
         ASSERT_EQ(types.size(), 1);
         EXPECT_EQ(types.first(), QString("1"));
     }
 
     // type change
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
         EXPECT_EQ(this->replace(one1, two1), QString("2"));
-        ASSERT_EQ(dp2->items.size(), 1);
-        EXPECT_EQ(dp2->items.first(), two1);
-        EXPECT_TRUE(dp->items.isEmpty());
+        ASSERT_EQ(dp2->items().size(), 1);
+        EXPECT_EQ(dp2->items().first(), two1);
+        EXPECT_TRUE(dp->items().isEmpty());
         ASSERT_EQ(types.size(), 2);
         EXPECT_EQ(types.first(), QString("1"));
         EXPECT_EQ(types.last(), QString("2"));
@@ -198,55 +199,55 @@ TEST_F(TestFileClassifier2, append)
     // unknown
     {
         EXPECT_TRUE(this->append(test).isEmpty());
-        EXPECT_TRUE(dp->items.isEmpty());
-        EXPECT_TRUE(dp2->items.isEmpty());
+        EXPECT_TRUE(dp->items().isEmpty());
+        EXPECT_TRUE(dp2->items().isEmpty());
         EXPECT_TRUE(types.isEmpty());
     }
 
     // do not exist
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
         EXPECT_EQ(this->append(one1), QString("1"));
-        ASSERT_EQ(dp->items.size(), 1);
-        EXPECT_EQ(dp->items.first(), one1);
-        EXPECT_TRUE(dp2->items.isEmpty());
+        ASSERT_EQ(dp->items().size(), 1);
+        EXPECT_EQ(dp->items().first(), one1);
+        EXPECT_TRUE(dp2->items().isEmpty());
         ASSERT_EQ(types.size(), 1);
         EXPECT_EQ(types.first(), QString("1"));
 
         types.clear();
         EXPECT_EQ(this->append(two1), QString("2"));
-        ASSERT_EQ(dp2->items.size(), 1);
-        EXPECT_EQ(dp2->items.first(), two1);
-        EXPECT_EQ(dp->items.size(), 1);
+        ASSERT_EQ(dp2->items().size(), 1);
+        EXPECT_EQ(dp2->items().first(), two1);
+        EXPECT_EQ(dp->items().size(), 1);
         ASSERT_EQ(types.size(), 1);
         EXPECT_EQ(types.first(), QString("2"));
 
         types.clear();
         EXPECT_EQ(this->append(one2), QString("1"));
-        ASSERT_EQ(dp->items.size(), 2);
-        EXPECT_EQ(dp->items.last(), one2);
+        ASSERT_EQ(dp->items().size(), 2);
+        EXPECT_EQ(dp->items().last(), one2);
     }
 
     // exist and same
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
         EXPECT_EQ(this->append(one1), QString("1"));
-        EXPECT_EQ(dp->items.size(), 1);
-        EXPECT_TRUE(dp2->items.isEmpty());
+        EXPECT_EQ(dp->items().size(), 1);
+        EXPECT_TRUE(dp2->items().isEmpty());
         EXPECT_TRUE(types.isEmpty());
     }
 
     // replace
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
 
         stub.set_lamda(VADDR(TestFileClassifier, classify), [this](TestFileClassifier *self, const QUrl &url) {
             EXPECT_EQ(self->ids.key(url.fileName().left(3)), QString("1"));
@@ -254,17 +255,17 @@ TEST_F(TestFileClassifier2, append)
         });
 
         EXPECT_EQ(this->append(one1), QString("2"));
-        EXPECT_TRUE(dp->items.isEmpty());
-        ASSERT_EQ(dp2->items.size(), 1);
-        EXPECT_EQ(dp2->items.first(), one1);
+        EXPECT_TRUE(dp->items().isEmpty());
+        ASSERT_EQ(dp2->items().size(), 1);
+        EXPECT_EQ(dp2->items().first(), one1);
         ASSERT_EQ(types.size(), 2);
         EXPECT_EQ(types.first(), QString("1"));
         EXPECT_EQ(types.last(), QString("2"));
 
-        dp->items.append(one2);
+        insertItem(dp->key, one2);
         EXPECT_EQ(this->append(one2), QString("2"));
-        ASSERT_EQ(dp2->items.size(), 2);
-        EXPECT_EQ(dp2->items.last(), one2);
+        ASSERT_EQ(dp2->items().size(), 2);
+        EXPECT_EQ(dp2->items().last(), one2);
     }
 }
 
@@ -275,56 +276,56 @@ TEST_F(TestFileClassifier2, prepend)
     // unknown
     {
         EXPECT_TRUE(this->prepend(test).isEmpty());
-        EXPECT_TRUE(dp->items.isEmpty());
-        EXPECT_TRUE(dp2->items.isEmpty());
+        EXPECT_TRUE(dp->items().isEmpty());
+        EXPECT_TRUE(dp2->items().isEmpty());
         EXPECT_TRUE(types.isEmpty());
     }
 
     // do not exist
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
         EXPECT_EQ(this->prepend(one1), QString("1"));
-        ASSERT_EQ(dp->items.size(), 1);
-        EXPECT_EQ(dp->items.first(), one1);
-        EXPECT_TRUE(dp2->items.isEmpty());
+        ASSERT_EQ(dp->items().size(), 1);
+        EXPECT_EQ(dp->items().first(), one1);
+        EXPECT_TRUE(dp2->items().isEmpty());
         ASSERT_EQ(types.size(), 1);
         EXPECT_EQ(types.first(), QString("1"));
 
         types.clear();
         EXPECT_EQ(this->prepend(two1), QString("2"));
-        ASSERT_EQ(dp2->items.size(), 1);
-        EXPECT_EQ(dp2->items.first(), two1);
-        EXPECT_EQ(dp->items.size(), 1);
+        ASSERT_EQ(dp2->items().size(), 1);
+        EXPECT_EQ(dp2->items().first(), two1);
+        EXPECT_EQ(dp->items().size(), 1);
         ASSERT_EQ(types.size(), 1);
         EXPECT_EQ(types.first(), QString("2"));
 
         types.clear();
         EXPECT_EQ(this->prepend(one2), QString("1"));
-        ASSERT_EQ(dp->items.size(), 2);
-        EXPECT_EQ(dp->items.first(), one2);
-        EXPECT_EQ(dp->items.last(), one1);
+        ASSERT_EQ(dp->items().size(), 2);
+        EXPECT_EQ(dp->items().first(), one2);
+        EXPECT_EQ(dp->items().last(), one1);
     }
 
     // exist and same
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
         EXPECT_EQ(this->prepend(one1), QString("1"));
-        EXPECT_EQ(dp->items.size(), 1);
-        EXPECT_TRUE(dp2->items.isEmpty());
+        EXPECT_EQ(dp->items().size(), 1);
+        EXPECT_TRUE(dp2->items().isEmpty());
         EXPECT_TRUE(types.isEmpty());
     }
 
     // replace
     {
-        dp->items.clear();
-        dp2->items.clear();
+        setItems(dp->key, {});
+        setItems(dp2->key, {});
         types.clear();
-        dp->items.append(one1);
+        insertItem(dp->key, one1);
 
         stub.set_lamda(VADDR(TestFileClassifier, classify), [this](TestFileClassifier *self, const QUrl &url) {
             EXPECT_EQ(self->ids.key(url.fileName().left(3)), QString("1"));
@@ -332,49 +333,49 @@ TEST_F(TestFileClassifier2, prepend)
         });
 
         EXPECT_EQ(this->prepend(one1), QString("2"));
-        EXPECT_TRUE(dp->items.isEmpty());
-        ASSERT_EQ(dp2->items.size(), 1);
-        EXPECT_EQ(dp2->items.first(), one1);
+        EXPECT_TRUE(dp->items().isEmpty());
+        ASSERT_EQ(dp2->items().size(), 1);
+        EXPECT_EQ(dp2->items().first(), one1);
         ASSERT_EQ(types.size(), 2);
         EXPECT_EQ(types.first(), QString("1"));
         EXPECT_EQ(types.last(), QString("2"));
 
-        dp->items.append(one2);
+        insertItem(dp->key, one2);
         EXPECT_EQ(this->prepend(one2), QString("2"));
-        ASSERT_EQ(dp2->items.size(), 2);
-        EXPECT_EQ(dp2->items.first(), one2);
-        EXPECT_EQ(dp2->items.last(), one1);
+        ASSERT_EQ(dp2->items().size(), 2);
+        EXPECT_EQ(dp2->items().first(), one2);
+        EXPECT_EQ(dp2->items().last(), one1);
     }
 }
 
 TEST_F(TestFileClassifier2, remove)
 {
     initDP();
-    dp->items.append(one1);
-    dp2->items.append(two1);
+    insertItem(dp->key, one1);
+    insertItem(dp2->key, two1);
 
     EXPECT_TRUE(this->remove(test).isEmpty());
     EXPECT_TRUE(types.isEmpty());
-    EXPECT_EQ(dp->items.size(), 1);
-    EXPECT_EQ(dp2->items.size(), 1);
+    EXPECT_EQ(dp->items().size(), 1);
+    EXPECT_EQ(dp2->items().size(), 1);
 
     types.clear();
     EXPECT_TRUE(this->remove(one2).isEmpty());
     EXPECT_TRUE(types.isEmpty());
-    EXPECT_EQ(dp->items.size(), 1);
-    EXPECT_EQ(dp2->items.size(), 1);
+    EXPECT_EQ(dp->items().size(), 1);
+    EXPECT_EQ(dp2->items().size(), 1);
 
     types.clear();
     EXPECT_EQ(this->remove(one1), QString("1"));
-    EXPECT_TRUE(dp->items.isEmpty());
-    EXPECT_EQ(dp2->items.size(), 1);
+    EXPECT_TRUE(dp->items().isEmpty());
+    EXPECT_EQ(dp2->items().size(), 1);
     ASSERT_EQ(types.size(), 1);
     EXPECT_EQ(types.first(), QString("1"));
 
     types.clear();
     EXPECT_EQ(this->remove(two1), QString("2"));
-    EXPECT_TRUE(dp->items.isEmpty());
-    EXPECT_TRUE(dp2->items.isEmpty());
+    EXPECT_TRUE(dp->items().isEmpty());
+    EXPECT_TRUE(dp2->items().isEmpty());
     ASSERT_EQ(types.size(), 1);
     EXPECT_EQ(types.first(), QString("2"));
 }
@@ -385,7 +386,7 @@ TEST_F(TestFileClassifier2, change)
     EXPECT_TRUE(this->change(one1).isEmpty());
     EXPECT_TRUE(types.isEmpty());
 
-    dp->items.append(one1);
+    insertItem(dp->key, one1);
     types.clear();
     EXPECT_TRUE(this->change(one1).isEmpty());
     EXPECT_TRUE(types.isEmpty());
@@ -397,9 +398,9 @@ TEST_F(TestFileClassifier2, change)
 
     types.clear();
     EXPECT_EQ(this->change(one1), QString("2"));
-    EXPECT_TRUE(dp->items.isEmpty());
-    ASSERT_EQ(dp2->items.size(), 1);
-    EXPECT_EQ(dp2->items.first(), one1);
+    EXPECT_TRUE(dp->items().isEmpty());
+    ASSERT_EQ(dp2->items().size(), 1);
+    EXPECT_EQ(dp2->items().first(), one1);
     ASSERT_EQ(types.size(), 2);
     EXPECT_EQ(types.first(), QString("1"));
     EXPECT_EQ(types.last(), QString("2"));
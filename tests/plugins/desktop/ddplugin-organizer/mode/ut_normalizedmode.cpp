@@ -197,7 +197,7 @@ TEST_F(TestNormalizedMode, switchCollection)
     CollectionBaseDataPtr base1(new CollectionBaseData);
     base1->key = "1";
     base1->name = "one";
-    this->collections.insert("1", base1);
+    this->addCollection(base1);
     // empty item
     {
         mp->switchCollection();
@@ -212,7 +212,7 @@ TEST_F(TestNormalizedMode, switchCollection)
         key.clear();
         layout = false;
         QUrl one = QUrl::fromLocalFile("/tmp/1");
-        base1->items.append(one);
+        this->insertItem(base1->key, one);
         mp->switchCollection();
         EXPECT_EQ(key, QString("1"));
         EXPECT_TRUE(layout);
@@ -235,7 +235,7 @@ TEST_F(TestNormalizedMode, switchCollection)
     {
         key.clear();
         layout = false;
-        base1->items.clear();
+        this->setItems(base1->key, {});
         mp->holders.insert("2", holder);
         mp->switchCollection();
         EXPECT_TRUE(key.isEmpty());
@@ -251,24 +251,73 @@ TEST_F(TestNormalizedMode, restore)
     CollectionBaseDataPtr base1(new CollectionBaseData);
     base1->key = "1";
     base1->name = "one";
-    this->collections.insert("1", base1);
+    this->addCollection(base1);
     QUrl one = QUrl::fromLocalFile("/tmp/1");
-    base1->items.append(one);
+    this->insertItem(base1->key, one);
 
     QUrl two = QUrl::fromLocalFile("/tmp/2");
-    base1->items.append(two);
+    this->insertItem(base1->key, two);
 
-    CollectionBaseDataPtr base2(new CollectionBaseData);
+    QUrl three = QUrl::fromLocalFile("/tmp/3");
+    CollectionBaseDataPtr base2(new CollectionBaseData({ three, two }));
     base2->key = "1";
     base2->name = "one";
-    QUrl three = QUrl::fromLocalFile("/tmp/3");
-    base2->items.append(three);
-    base2->items.append(two);
 
     mp->restore({base2});
-    ASSERT_EQ(base1->items.size(), 2);
-    EXPECT_EQ(base1->items.first(), two);
-    EXPECT_EQ(base1->items.last(), one);
+    ASSERT_EQ(base1->items().size(), 2);
+    EXPECT_EQ(base1->items().first(), two);
+    EXPECT_EQ(base1->items().last(), one);
+}
+
+TEST_F(TestNormalizedMode, applyFileChanges)
+{
+    stub.set_lamda(&ConfigPresenter::organizeOnTriggered, []() {
+        return false;
+    });
+    stub.set_lamda(&NormalizedModePrivate::switchCollection, []() {});
+
+    QStringList changed;
+    connect(this, &FileClassifier::itemsChanged, this, [&changed](const QString &key) {
+        changed.append(key);
+    });
+    int collectionChanged = 0;
+    connect(&nmode, &NormalizedMode::collectionChanged, this, [&collectionChanged]() {
+        ++collectionChanged;
+    });
+
+    CollectionBaseDataPtr base1(new CollectionBaseData);
+    base1->key = "1";
+    this->addCollection(base1);
+    CollectionBaseDataPtr base2(new CollectionBaseData);
+    base2->key = "2";
+    this->addCollection(base2);
+
+    QUrl one1 = QUrl::fromLocalFile("/tmp/one1");
+    QUrl one2 = QUrl::fromLocalFile("/tmp/one2");
+    QUrl two1 = QUrl::fromLocalFile("/tmp/two1");
+    this->setItems(base1->key, { one1, one2 });
+    this->setItems(base2->key, { two1 });
+
+    // nothing changed
+    EXPECT_EQ(mp->applyFileChanges({ two1, one2, one1 }), 0);
+    EXPECT_TRUE(changed.isEmpty());
+    EXPECT_EQ(collectionChanged, 0);
+    EXPECT_EQ(base1->items(), QList<QUrl>({ one1, one2 }));
+
+    // one1 removed and one3 inserted, two is not touched.
+    QUrl one3 = QUrl::fromLocalFile("/tmp/one3");
+    EXPECT_EQ(mp->applyFileChanges({ one3, one2, two1 }), 2);
+    EXPECT_EQ(changed, QStringList { "1" });
+    // one3 is appended to a collection, the canvas has to drop it.
+    EXPECT_EQ(collectionChanged, 1);
+    EXPECT_EQ(base1->items(), QList<QUrl>({ one2, one3 }));
+    EXPECT_EQ(base2->items(), QList<QUrl>({ two1 }));
+
+    // only removed, nothing goes to or comes from the canvas.
+    changed.clear();
+    EXPECT_EQ(mp->applyFileChanges({ one3, two1 }), 1);
+    EXPECT_EQ(changed, QStringList { "1" });
+    EXPECT_EQ(collectionChanged, 1);
 }
 
 TEST_F(TestNormalizedMode, initialize)
@@ -381,11 +430,11 @@ TEST_F(TestNormalizedMode, rebuild)
     CollectionBaseDataPtr base1(new CollectionBaseData);
     base1->key = "1";
     base1->name = "one";
-    nmode.d->classifier->collections.insert("1", base1);
+    nmode.d->classifier->addCollection(base1);
     QUrl one = QUrl::fromLocalFile("/tmp/1");
-    base1->items.append(one);
-    QString s = nmode.d->classifier->collections.value("1")->key;
-    QUrl t = nmode.d->classifier->collections.value("1")->items.at(0);
+    nmode.d->classifier->insertItem(base1->key, one);
+    QString s = nmode.d->classifier->collection("1")->key;
+    QUrl t = nmode.d->classifier->collection("1")->items().at(0);
     nmode.rebuild();
 
     EXPECT_TRUE(call);
@@ -440,8 +489,9 @@ TEST_F(TestNormalizedMode,onFileRenamed)
     FileOperatorIns->d->renameFileData.insert(oldUrl,newUrl);
     EXPECT_NO_FATAL_FAILURE(nmode.onFileRenamed(oldUrl,newUrl));
     CollectionBaseDataPtr ptr(new CollectionBaseData);
-    ptr->items.push_back(newUrl);
-    nmode.d->classifier->collections.insert("url2",ptr);
+    ptr->key = "url2";
+    nmode.d->classifier->addCollection(ptr);
+    nmode.d->classifier->insertItem("url2", newUrl);
     EXPECT_NO_FATAL_FAILURE(nmode.onFileRenamed(oldUrl,newUrl));
     CollectionHolderPointer ptr1(new CollectionHolder("uuid",nullptr));
     nmode.d->holders.insert("url2", ptr1);
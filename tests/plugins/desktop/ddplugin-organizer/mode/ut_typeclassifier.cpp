@@ -76,3 +76,29 @@ TEST_F(TypeClassifierTest, classes_single)
         index++;
     }
 }
+
+TEST_F(TypeClassifierTest, suffixType)
+{
+    TypeClassifier obj;
+    const auto &table = obj.d->suffixTypes;
+    ASSERT_FALSE(table.isEmpty());
+    for (int i = 1; i < table.size(); ++i)
+        EXPECT_LT(table.at(i - 1).suffix, table.at(i).suffix);
+
+    EXPECT_STREQ(obj.d->suffixType("a.pdf"), "Type_Documents");
+    EXPECT_STREQ(obj.d->suffixType("a.b.PNG"), "Type_Pictures");
+    EXPECT_STREQ(obj.d->suffixType("a.Mp3"), "Type_Music");
+    EXPECT_STREQ(obj.d->suffixType("a.desktop"), "Type_Apps");
+    // trailing dots are skipped.
+    EXPECT_STREQ(obj.d->suffixType("report.pdf."), "Type_Documents");
+    EXPECT_STREQ(obj.d->suffixType("a.png.."), "Type_Pictures");
+
+    EXPECT_EQ(obj.d->suffixType("pdf"), nullptr);
+    EXPECT_EQ(obj.d->suffixType(".pdf"), nullptr);
+    EXPECT_EQ(obj.d->suffixType(".pdf."), nullptr);
+    EXPECT_EQ(obj.d->suffixType("pdf."), nullptr);
+    EXPECT_EQ(obj.d->suffixType("..."), nullptr);
+    EXPECT_EQ(obj.d->suffixType("a.unknown"), nullptr);
+    EXPECT_EQ(obj.d->suffixType("a.toolongsuffixname"), nullptr);
+    EXPECT_EQ(obj.d->suffixType(QString("a.p") + QChar(0x00e9)), nullptr);
+}
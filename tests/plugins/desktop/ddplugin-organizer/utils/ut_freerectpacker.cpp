@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/freerectpacker.h"
+
+#include <gtest/gtest.h>
+
+#include <QRandomGenerator>
+
+DDP_ORGANIZER_USE_NAMESPACE
+
+namespace {
+// the former scan: right to left, then top to bottom.
+bool scan(const QSize &table, const QList<QRect> &seats, const QSize &size, QPoint *pos)
+{
+    for (int x = table.width() - size.width(); x >= 0; --x) {
+        for (int y = 0; y <= table.height() - size.height(); ++y) {
+            QRect item({ x, y }, size);
+            bool free = true;
+            for (const QRect &seat : seats) {
+                if (seat.intersects(item)) {
+                    free = false;
+                    break;
+                }
+            }
+            if (free) {
+                *pos = { x, y };
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}
+
+TEST(FreeRectPacker, find)
+{
+    FreeRectPacker packer({ 10, 8 });
+    QPoint pos;
+    ASSERT_TRUE(packer.find({ 4, 3 }, &pos));
+    EXPECT_EQ(pos, QPoint(6, 0));
+
+    packer.occupy({ 6, 0, 4, 3 });
+    ASSERT_TRUE(packer.find({ 4, 3 }, &pos));
+    EXPECT_EQ(pos, QPoint(6, 3));
+
+    packer.occupy({ 6, 3, 4, 3 });
+    ASSERT_TRUE(packer.find({ 4, 3 }, &pos));
+    EXPECT_EQ(pos, QPoint(2, 0));
+
+    EXPECT_FALSE(packer.find({ 11, 1 }, &pos));
+    EXPECT_FALSE(packer.find({ 0, 0 }, &pos));
+
+    FreeRectPacker empty({ 3, 0 });
+    EXPECT_FALSE(empty.find({ 1, 1 }, &pos));
+}
+
+TEST(FreeRectPacker, same_as_scan)
+{
+    QRandomGenerator gen(7);
+    for (int round = 0; round < 50; ++round) {
+        const QSize table(gen.bounded(5, 30), gen.bounded(5, 20));
+        FreeRectPacker packer(table);
+        QList<QRect> seats;
+        for (int i = 0; i < 12; ++i) {
+            const QSize size(gen.bounded(1, 8), gen.bounded(1, 6));
+            QPoint expect;
+            QPoint pos;
+            const bool found = scan(table, seats, size, &expect);
+            ASSERT_EQ(packer.find(size, &pos), found);
+            if (!found)
+                continue;
+
+            EXPECT_EQ(pos, expect);
+            seats.append(QRect(pos, size));
+            packer.occupy(seats.last());
+
+            // something not placed by the packer, partly outside of the table.
+            QRect other(gen.bounded(-2, table.width()), gen.bounded(-2, table.height()), gen.bounded(1, 4), gen.bounded(1, 4));
+            seats.append(other);
+            packer.occupy(other);
+        }
+    }
+}
@@ -618,18 +618,15 @@ public:
 
         dlg = new CollectionItemDelegate(view);
 
-        dp.reset(new CollectionBaseData);
+        dp.reset(new CollectionBaseData({ one1, one2 }));
         dp->name = "one";
         dp->key = "1";
-        dp->items.append(one1);
-        dp->items.append(one2);
-        classifier.collections.insert("1", dp);
+        classifier.addCollection(dp);
 
-        dp2.reset(new CollectionBaseData);
+        dp2.reset(new CollectionBaseData({ two1 }));
         dp2->name = "two";
         dp2->key = "2";
-        dp2->items.append(two1);
-        classifier.collections.insert("2", dp2);
+        classifier.addCollection(dp2);
         view->setModel(model);
         view->d->rowCount = 2;
         view->d->columnCount = 3;
@@ -1126,11 +1123,10 @@ TEST_F(TestCollectionView, moveCursor)
 
     view->d->id = "temp_key";
 
-    CollectionBaseDataPtr ptr(new CollectionBaseData);
-    ptr->items.push_back(url2);
-    ptr->items.push_back(url1);
+    CollectionBaseDataPtr ptr(new CollectionBaseData({ url2, url1 }));
+    ptr->key = "temp_key";
 
-    view->d->provider->collections["temp_key"] = ptr;
+    view->d->provider->addCollection(ptr);
 
     Qt::KeyboardModifiers modifiers = Qt::KeyboardModifier::ShiftModifier;
 
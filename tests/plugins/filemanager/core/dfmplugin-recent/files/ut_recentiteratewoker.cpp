@@ -10,10 +10,13 @@
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/file/local/private/syncfileinfo_p.h>
 #include <dfm-base/interfaces/fileinfo.h>
+#include <dfm-base/utils/fileutils.h>
+#include <dfm-base/base/device/deviceutils.h>
 #include <gtest/gtest.h>
 
 #include <QPaintEvent>
 #include <QPainter>
+#include <QTemporaryDir>
 
 DFMBASE_USE_NAMESPACE
 using namespace dfmplugin_recent;
@@ -78,3 +81,59 @@ TEST_F(RecentIterateWorkerTest, onRecentFileChanged)
 
     EXPECT_EQ(flag, 2);
 }
+
+TEST_F(RecentIterateWorkerTest, onRecentFileChanged_Incremental)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString &filePath = dir.filePath("a.txt");
+    QFile recentFile(filePath);
+    ASSERT_TRUE(recentFile.open(QIODevice::WriteOnly));
+    recentFile.close();
+
+    const QString &xbelPath = dir.filePath("recently-used.xbel");
+    QFile xbel(xbelPath);
+    ASSERT_TRUE(xbel.open(QIODevice::WriteOnly | QIODevice::Text));
+    xbel.write(QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                       "<xbel version=\"1.0\">\n"
+                       "<bookmark href=\"%1\" modified=\"2023-01-01T00:00:00Z\"/>\n"
+                       "</xbel>\n")
+                       .arg(QUrl::fromLocalFile(filePath).toString())
+                       .toUtf8());
+    xbel.close();
+
+    int bindCount = 0;
+    stub.set_lamda(&RecentHelper::xbelPath, [xbelPath]() -> QString { return xbelPath; });
+    stub.set_lamda(&DeviceUtils::isLowSpeedDevice, []() -> bool { return false; });
+    stub.set_lamda(&FileUtils::bindPathTransform, [&bindCount](const QString &path, bool) -> QString {
+        ++bindCount;
+        return path;
+    });
+
+    RecentIterateWorker worker;
+    QList<QUrl> emitted;
+    QObject::connect(&worker, &RecentIterateWorker::updateRecentFileInfo, [&emitted](const QUrl &url, const QString, qint64) {
+        emitted << url;
+    });
+    QList<QUrl> deleted;
+    QObject::connect(&worker, &RecentIterateWorker::deleteExistRecentUrls, [&deleted](const QList<QUrl> &urls) {
+        deleted << urls;
+    });
+
+    worker.onRecentFileChanged({});
+    ASSERT_EQ(emitted.size(), 1);
+    EXPECT_EQ(bindCount, 1);
+
+    // unchanged xbel and cached urls: nothing is sent and the bind table is not consulted again
+    const QList<QUrl> cached { emitted };
+    emitted.clear();
+    worker.onRecentFileChanged(cached);
+    EXPECT_TRUE(emitted.isEmpty());
+    EXPECT_TRUE(deleted.isEmpty());
+    EXPECT_EQ(bindCount, 1);
+
+    // the recorded file is gone
+    QFile::remove(filePath);
+    worker.onRecentFileChanged(cached);
+    EXPECT_EQ(deleted, cached);
+}
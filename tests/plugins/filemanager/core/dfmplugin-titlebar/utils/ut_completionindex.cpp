@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2023 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/completionindex.h"
+
+#include <gtest/gtest.h>
+
+DPTITLEBAR_USE_NAMESPACE
+
+TEST(UT_CompletionIndex, match)
+{
+    const QStringList names { ".hidden", "Music", "lib", "lib32", "lib64", "libexec", "local", "sbin" };
+
+    EXPECT_EQ(CompletionIndex::match(names, "lib", 10), QStringList({ "lib", "lib32", "lib64", "libexec" }));
+    EXPECT_EQ(CompletionIndex::match(names, "lib", 2), QStringList({ "lib", "lib32" }));
+    EXPECT_EQ(CompletionIndex::match(names, "", 3), QStringList({ ".hidden", "Music", "lib" }));
+    // the completer is case sensitive.
+    EXPECT_TRUE(CompletionIndex::match(names, "music", 10).isEmpty());
+    EXPECT_TRUE(CompletionIndex::match(names, "z", 10).isEmpty());
+    EXPECT_TRUE(CompletionIndex::match({}, "lib", 10).isEmpty());
+}
+
+TEST(UT_CompletionIndex, find)
+{
+    QStringList names;
+    EXPECT_FALSE(CompletionIndex::instance()->find(QUrl::fromLocalFile("/not/listed/dir"), "", 10, &names));
+    EXPECT_TRUE(names.isEmpty());
+}
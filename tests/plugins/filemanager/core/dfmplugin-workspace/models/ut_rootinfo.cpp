@@ -427,6 +427,27 @@ TEST_F(UT_RootInfo, HandleTraversalLocalResult)
     EXPECT_TRUE(sendIteratorLocalFiles);
 }
 
+TEST_F(UT_RootInfo, HandleTraversalLocalResult_Runs)
+{
+    stub.set_lamda((void(RootInfo::*)(const QList<SortInfoPointer> &))ADDR(RootInfo, addChildren),
+                   [](RootInfo *, const QList<SortInfoPointer> &) {});
+
+    QList<bool> finishedFlags;
+    QObject::connect(rootInfoObj, &RootInfo::iteratorLocalFiles, rootInfoObj,
+                     [&finishedFlags](const QString &, const QList<SortInfoPointer>,
+                                      const dfmio::DEnumerator::SortRoleCompareFlag, const Qt::SortOrder,
+                                      const bool, const bool isFinished) { finishedFlags.append(isFinished); });
+
+    auto sortRole = dfmio::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileName;
+    rootInfoObj->traversaling = true;
+    rootInfoObj->handleTraversalLocalResult({ SortInfoPointer::create() }, sortRole, Qt::AscendingOrder, false, "travseToken", false);
+    EXPECT_TRUE(rootInfoObj->traversaling);
+
+    rootInfoObj->handleTraversalLocalResult({ SortInfoPointer::create() }, sortRole, Qt::AscendingOrder, false, "travseToken", true);
+    EXPECT_FALSE(rootInfoObj->traversaling);
+    EXPECT_EQ(finishedFlags, QList<bool>({ false, true }));
+}
+
 TEST_F(UT_RootInfo, HandleTraversalFinish)
 {
     rootInfoObj->traversalFinish = false;
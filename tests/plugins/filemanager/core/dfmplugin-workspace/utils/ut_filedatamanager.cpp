@@ -16,6 +16,9 @@
 #include <gtest/gtest.h>
 
 #include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QThread>
 
 DFMBASE_USE_NAMESPACE
 DFMGLOBAL_USE_NAMESPACE
@@ -205,6 +208,23 @@ TEST_F(UT_FileDataManager, CreateRoot)
     EXPECT_NE(manager->rootInfoMap.value(url), nullptr);
 }
 
+TEST_F(UT_FileDataManager, CreateRootCanCache)
+{
+    stub.set_lamda(ADDR(FileDataManager, checkNeedCache), [] { return false; });
+    manager->snapshotByteLimit = 64 * 1024 * 1024;
+
+    // only local roots can be kept as a snapshot
+    const QUrl localUrl = QUrl::fromLocalFile("/tmp");
+    EXPECT_TRUE(manager->createRoot(localUrl)->canCache);
+
+    const QUrl searchUrl("search:?url=file:///tmp&keyword=a");
+    EXPECT_FALSE(manager->createRoot(searchUrl)->canCache);
+
+    manager->snapshotByteLimit = 0;
+    const QUrl otherUrl = QUrl::fromLocalFile("/var");
+    EXPECT_FALSE(manager->createRoot(otherUrl)->canCache);
+}
+
 TEST_F(UT_FileDataManager, CheckNeedCache)
 {
     QUrl url(QStandardPaths::standardLocations(QStandardPaths::DocumentsLocation).first());
@@ -222,3 +242,50 @@ TEST_F(UT_FileDataManager, CheckNeedCache)
     manager->cacheDataSchemes.append(Scheme::kFile);
     EXPECT_TRUE(manager->checkNeedCache(url));
 }
+
+TEST_F(UT_FileDataManager, Snapshot)
+{
+    stub.set_lamda(ADDR(RootInfo, clearTraversalThread), [] { return 0; });
+    stub.set_lamda(ADDR(FileDataManager, checkNeedCache), [] { return false; });
+    stub.set_lamda(ADDR(RootInfo, childrenCount), [] { return 1024; });
+
+    QTemporaryDir dirA;
+    QTemporaryDir dirB;
+    QUrl urlA = QUrl::fromLocalFile(dirA.path());
+    QUrl urlB = QUrl::fromLocalFile(dirB.path());
+    QString key("tempkey");
+
+    // room for one directory only.
+    manager->snapshotByteLimit = 1024 * FileDataManager::kSnapshotBytesPerChild;
+
+    RootInfo *rootA = new RootInfo(urlA, true);
+    rootA->traversalFinish = true;
+    manager->rootInfoMap.insert(urlA, rootA);
+    manager->cleanRoot(urlA, key);
+    EXPECT_TRUE(manager->snapshots.contains(urlA));
+    EXPECT_EQ(manager->rootInfoMap.value(urlA), rootA);
+
+    RootInfo *rootB = new RootInfo(urlB, true);
+    rootB->traversalFinish = true;
+    manager->rootInfoMap.insert(urlB, rootB);
+    manager->cleanRoot(urlB, key);
+    EXPECT_TRUE(manager->snapshots.contains(urlB));
+    EXPECT_FALSE(manager->snapshots.contains(urlA));
+    EXPECT_FALSE(manager->rootInfoMap.contains(urlA));
+    EXPECT_EQ(manager->snapshotBytes, 1024 * FileDataManager::kSnapshotBytesPerChild);
+
+    // no watcher, so the directory must be unchanged.
+    EXPECT_EQ(manager->fetchRoot(urlB), rootB);
+    EXPECT_TRUE(manager->snapshots.isEmpty());
+    EXPECT_EQ(manager->snapshotBytes, 0);
+
+    manager->cleanRoot(urlB, key);
+    EXPECT_TRUE(manager->snapshots.contains(urlB));
+    QThread::msleep(10);
+    QFile file(dirB.filePath("new"));
+    file.open(QIODevice::WriteOnly);
+    file.close();
+    RootInfo *fetched = manager->fetchRoot(urlB);
+    EXPECT_NE(fetched, rootB);
+    EXPECT_EQ(manager->rootInfoMap.value(urlB), fetched);
+}
@@ -70,3 +70,36 @@ TEST_F(UT_FileSortWorker, Bug_199473_handleUpdateFile)
 
     EXPECT_EQ(selectAndEditFile, updateFile);
 }
+
+TEST_F(UT_FileSortWorker, handleIteratorLocalChildren_MergeSortedRuns)
+{
+    stub.set_lamda(ADDR(FileSortWorker, checkFilters), []{
+        return true;
+    });
+    stub.set_lamda(ADDR(FileSortWorker, lessThan), [](FileSortWorker *, const QUrl &left, const QUrl &right,
+                                                      AbstractSortFilter::SortScenarios) {
+        return left.path() < right.path();
+    });
+    worker->orgSortRole = kItemFileDisplayNameRole;
+    worker->sortOrder = Qt::AscendingOrder;
+
+    auto run = [this](const QStringList &names) {
+        QList<SortInfoPointer> children;
+        for (const auto &name : names) {
+            SortInfoPointer sortInfo(new SortFileInfo());
+            sortInfo->setUrl(QUrl::fromLocalFile(url.path() + "/" + name));
+            sortInfo->setFile(true);
+            children.append(sortInfo);
+        }
+        return children;
+    };
+    worker->handleIteratorLocalChildren(key, run({ "b", "d", "f" }), DFMIO::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileName,
+                                        Qt::AscendingOrder, false, false);
+    worker->handleIteratorLocalChildren(key, run({ "e", "a", "c" }), DFMIO::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileName,
+                                        Qt::AscendingOrder, false, true);
+
+    QStringList names;
+    for (const auto &child : worker->getChildrenUrls())
+        names.append(child.fileName());
+    EXPECT_EQ(names, QStringList({ "a", "b", "c", "d", "e", "f" }));
+}
@@ -8,6 +8,7 @@
 
 #include <dfm-base/file/local/syncfileinfo.h>
 #include <dfm-base/base/schemefactory.h>
+#include <dfm-base/utils/hidefilehelper.h>
 
 #include <dfm-framework/event/event.h>
 
@@ -167,6 +168,46 @@ TEST(SearchHelperTest, ut_checkWildcardAndToRegularExpression)
 TEST(SearchHelperTest, ut_isHiddenFile)
 {
     QString path = QDir::homePath();
-    QHash<QString, QSet<QString>> filters;
+    HiddenFilters filters;
     EXPECT_NO_FATAL_FAILURE(SearchHelper::instance()->isHiddenFile(path, filters, "/"));
 }
+
+TEST(SearchHelperTest, ut_isHiddenFile_memoized)
+{
+    // /s/d<i>/e<j>/f<k>, d7 is hidden in /s, e3 is hidden in every /s/d<i> that i % 5 == 0
+    stub_ext::StubExt st;
+    int probes = 0;
+    st.set_lamda(&HideFileHelper::hideListOf, [&probes](const QString &dirPath) {
+        ++probes;
+        if (dirPath == "/s")
+            return QSet<QString> { "d7" };
+        if (dirPath.count('/') == 2 && dirPath.mid(4).toInt() % 5 == 0)
+            return QSet<QString> { "e3" };
+        return QSet<QString>();
+    });
+
+    const int dirs = 1000;
+    const int subDirs = 7;
+    HiddenFilters filters;
+    int hiddenCount = 0;
+    for (int k = 0; k < 500000; ++k) {
+        const int i = k % dirs;
+        const int j = (k / dirs) % subDirs;
+        const bool dotFile = k % 97 == 0;
+        const QString path = QString("/s/d%1/e%2/%3f%4").arg(i).arg(j).arg(dotFile ? "." : "").arg(k);
+
+        const bool expected = dotFile || i == 7 || (i % 5 == 0 && j == 3);
+        const bool hidden = SearchHelper::instance()->isHiddenFile(path, filters, "/s");
+        ASSERT_EQ(hidden, expected) << path.toStdString();
+        hiddenCount += hidden;
+    }
+
+    EXPECT_GT(hiddenCount, 0);
+    // every directory is probed once: /s, /s/d<i> and /s/d<i>/e<j>.
+    EXPECT_EQ(probes, 1 + dirs + dirs * subDirs);
+
+    // the states are dropped in another search path, the hide lists are kept.
+    EXPECT_FALSE(SearchHelper::instance()->isHiddenFile("/s/d7/e1/f", filters, "/s/d7"));
+    EXPECT_TRUE(SearchHelper::instance()->isHiddenFile("/s/d7/e1/f", filters, "/s"));
+    EXPECT_EQ(probes, 1 + dirs + dirs * subDirs);
+}